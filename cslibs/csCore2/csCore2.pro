@@ -9,6 +9,8 @@ TEMPLATE = lib
 include(../../global.pri)
 TARGET = csCore2$${TARGET_POSTFIX}
 
+CONFIG += c++17
+
 DESTDIR    = ../../lib
 DLLDESTDIR = ../../bin
 
@@ -25,28 +27,78 @@ win32:LIBS += shell32.lib
 
 
 SOURCES += \
+    src/cpu.cpp \
     src/csAlphaNum.cpp \
     src/csChar.cpp \
+    src/csFile.cpp \
+    src/csFuzzyMatcher.cpp \
+    src/csGlob.cpp \
+    src/csHash.cpp \
     src/csLimits.cpp \
+    src/csMappedFile.cpp \
+    src/csMultiMatcher.cpp \
+    src/csNaturalSort.cpp \
+    src/csNumberParser.cpp \
     src/csString.cpp \
+    src/csStringBuilder.cpp \
     src/csStringLib.cpp \
-    src/csStringList.cpp
+    src/csStringList.cpp \
+    src/csStringPool.cpp \
+    src/csStringSort.cpp \
+    src/csStringSplit.cpp \
+    src/csStringTable.cpp \
+    src/csStringView.cpp \
+    src/csUtf.cpp \
+    src/floatconv.cpp \
+    src/simd_string.cpp \
+    src/unicodecase.cpp
 
 win32 {
 SOURCES += \
     src/csFile_win32.cpp \
+    src/csMappedFile_win32.cpp \
     src/csProcess_win32.cpp
 }
 
+unix {
+SOURCES += \
+    src/csFile_posix.cpp \
+    src/csMappedFile_posix.cpp
+}
+
 HEADERS += \
     ../include/csCore2/csAlphaNum.h \
     ../include/csCore2/csChar.h \
     ../include/csCore2/cscore2_config.h \
     ../include/csCore2/cscore2_features.h \
+    ../include/csCore2/csFlatHash.h \
+    ../include/csCore2/csFuzzyMatcher.h \
+    ../include/csCore2/csGlob.h \
+    ../include/csCore2/csHash.h \
     ../include/csCore2/csLimits.h \
+    ../include/csCore2/csMappedFile.h \
+    ../include/csCore2/csMultiMatcher.h \
+    ../include/csCore2/csNaturalSort.h \
+    ../include/csCore2/csNumberParser.h \
     ../include/csCore2/csString.h \
+    ../include/csCore2/csStringBuilder.h \
     ../include/csCore2/csStringLib.h \
     ../include/csCore2/csStringList.h \
+    ../include/csCore2/csStringPool.h \
+    ../include/csCore2/csStringSort.h \
+    ../include/csCore2/csStringSplit.h \
+    ../include/csCore2/csStringTable.h \
+    ../include/csCore2/csStringView.h \
+    ../include/csCore2/csUtf.h \
     ../include/csCore2/csUtil.h \
     ../include/csCore2/csFile.h \
-    ../include/csCore2/csProcess.h
+    ../include/csCore2/csProcess.h \
+    include/internal/cpu.h \
+    include/internal/file.h \
+    include/internal/floatconv.h \
+    include/internal/mappedfile.h \
+    include/internal/parallel.h \
+    include/internal/simd_string.h \
+    include/internal/stringsort.h \
+    include/internal/twoway.h \
+    include/internal/unicodecase.h
@@ -0,0 +1,153 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CPU_H__
+#define __CPU_H__
+
+#include <csCore2/cscore2_config.h>
+
+/****************************************************************************
+ * Architecture *************************************************************
+ ****************************************************************************/
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+# define CS_ARCH_X86
+#endif
+
+// NOTE: SSE2 is part of x86-64; it may be used without checking the CPU.
+#if defined(_M_X64) || defined(__x86_64__)
+# define CS_ARCH_X64
+#endif
+
+/****************************************************************************
+ * Per-function instruction set selection ***********************************
+ ****************************************************************************/
+
+// NOTE: MSVC accepts any intrinsic without additional compiler switches;
+//       GCC & Clang require the target to be enabled per function.
+
+#if defined(__GNUC__) || defined(__clang__)
+# define CS_TARGET_SSE2    __attribute__((target("sse2")))
+# define CS_TARGET_AVX2    __attribute__((target("avx2,bmi")))
+# define CS_TARGET_AVX512  __attribute__((target("avx2,bmi,avx512f,avx512bw")))
+#else
+# define CS_TARGET_SSE2
+# define CS_TARGET_AVX2
+# define CS_TARGET_AVX512
+#endif
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+namespace priv_cpu {
+
+  enum Level {
+    Scalar = 0,
+    SSE2,
+    AVX2,
+    AVX512
+  };
+
+  // Highest instruction set supported by both the CPU and the OS;
+  // detected once and cached.
+  Level level();
+
+  inline int ctz32(const uint32_t x)
+  {
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward(&idx, x);
+    return int(idx);
+#else
+    return __builtin_ctz(x);
+#endif
+  }
+
+  inline int ctz64(const uint64_t x)
+  {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanForward64(&idx, x);
+    return int(idx);
+#elif defined(_MSC_VER)
+    const uint32_t lo = uint32_t(x);
+    return lo != 0
+        ? ctz32(lo)
+        : 32 + ctz32(uint32_t(x >> 32));
+#else
+    return __builtin_ctzll(x);
+#endif
+  }
+
+  inline int clz64(const uint64_t x)
+  {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long idx;
+    _BitScanReverse64(&idx, x);
+    return 63 - int(idx);
+#elif defined(_MSC_VER)
+    unsigned long idx;
+    const uint32_t hi = uint32_t(x >> 32);
+    if( hi != 0 ) {
+      _BitScanReverse(&idx, hi);
+      return 31 - int(idx);
+    }
+    _BitScanReverse(&idx, uint32_t(x));
+    return 63 - int(idx);
+#else
+    return __builtin_clzll(x);
+#endif
+  }
+
+  inline int popcount64(uint64_t x)
+  {
+#ifdef _MSC_VER
+    // NOTE: __popcnt64() requires the POPCNT instruction.
+    x = x - ((x >> 1) & 0x5555555555555555);
+    x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0F;
+    return int((x*0x0101010101010101) >> 56);
+#else
+    return __builtin_popcountll(x);
+#endif
+  }
+
+  // Does reading numBytes from p stay within p's page?
+  inline bool isPageSafe(const void *p, const size_t numBytes)
+  {
+    const uintptr_t PAGE_SIZE = 4096;
+    return (reinterpret_cast<uintptr_t>(p) & (PAGE_SIZE - 1)) <= PAGE_SIZE - numBytes;
+  }
+
+}; // namespace priv_cpu
+
+#endif // __CPU_H__
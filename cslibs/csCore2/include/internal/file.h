@@ -0,0 +1,92 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __FILE_H__
+#define __FILE_H__
+
+#include <functional>
+#include <string>
+
+#include <csCore2/csFile.h>
+
+// Primitives implemented by each operating system's backend
+
+namespace priv_file {
+
+#ifdef CS_OS_WINDOWS
+  const wchar_t SEPARATOR = L'\\';
+
+  typedef wchar_t NativeChar;
+#else
+  const wchar_t SEPARATOR = L'/';
+
+  typedef char NativeChar; // names are bytes, mostly UTF-8
+#endif
+
+  // A path as passed to the operating system; paths built from the native
+  // names listed are never decoded and encoded again.
+  typedef std::basic_string<NativeChar> NativePath;
+
+  // Returns false if path has no native representation.
+  bool toNative(NativePath *native, const csWStringView& path);
+
+  // Identifies a directory, independent of the path leading to it
+  struct FileId {
+    uint64_t volume;
+    uint64_t index;
+  };
+
+  inline bool operator==(const FileId& a, const FileId& b)
+  {
+    return a.volume == b.volume  &&  a.index == b.index;
+  }
+
+  struct FileIdHash {
+    size_t operator()(const FileId& id) const
+    {
+      return size_t((id.index ^ id.volume*0x9E3779B97F4A7C15)*0x9E3779B97F4A7C15);
+    }
+  };
+
+  // Returning false stops the listing; nativeName is NUL terminated.
+  typedef std::function<bool(const csWStringView& name, const NativeChar *nativeName,
+                             const csFileType type)> EntryFunc;
+
+  // Calls func for every entry of dir except "." and ".."; returns false if
+  // dir cannot be listed completely.
+  bool forEachEntry(const NativePath& dir, const EntryFunc& func);
+
+  // Type and identity of the file path refers to, following links
+  bool queryTarget(const NativePath& path, csFileType *type, FileId *id);
+
+}; // namespace priv_file
+
+#endif // __FILE_H__
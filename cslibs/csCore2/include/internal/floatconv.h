@@ -0,0 +1,91 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __FLOATCONV_H__
+#define __FLOATCONV_H__
+
+#include <csCore2/cscore2_config.h>
+
+namespace priv_floatconv {
+
+  // significand * 10^exponent
+  struct Decimal {
+    uint64_t significand;
+    int      exponent;
+  };
+
+  // Shortest decimal, without trailing zeros, that rounds to value
+  // (Schubfach); value must be finite and positive.
+  Decimal toDecimal(const double value);
+  Decimal toDecimal(const float value);
+
+  // Correctly rounded significand * 10^exponent using Clinger's fast
+  // path or the Eisel-Lemire algorithm; false if neither can decide.
+  bool toBinary(const uint64_t significand, const int exponent, double *value);
+  bool toBinary(const uint64_t significand, const int exponent, float *value);
+
+  // Arbitrary precision decimal for the slow path; i.e. for the inputs
+  // the fast algorithms cannot decide.
+  class BigDecimal {
+  public:
+    BigDecimal();
+
+    void appendIntegerDigit(const int digit);
+    void appendFractionDigit(const int digit);
+    void addExponent(const int exponent);
+
+    void toBinary(double *value);
+    void toBinary(float *value);
+
+  private:
+    enum {
+      MAX_DIGITS = 800
+    };
+
+    template<typename T>
+    uint64_t toBits();
+
+    inline void append(const int digit);
+    void leftShift(const int shift);
+    void rightShift(const int shift);
+    uint64_t roundedInteger() const;
+    void shift(int shift);
+    void trim();
+
+    int  _numDigits;
+    int  _decimalPoint; // value = 0.digits * 10^_decimalPoint
+    bool _isTruncated;  // non-zero digits were dropped
+    uint8_t _digits[MAX_DIGITS + 20];
+  };
+
+}; // namespace priv_floatconv
+
+#endif // __FLOATCONV_H__
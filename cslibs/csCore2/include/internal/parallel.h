@@ -0,0 +1,248 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <csCore2/cscore2_config.h>
+
+namespace priv_parallel {
+
+  // Requested thread count; < 1 selects the number of hardware threads
+  inline size_t threadCount(const int count)
+  {
+    if( count > 0 ) {
+      return size_t(count);
+    }
+    const unsigned int hw = std::thread::hardware_concurrency();
+    return hw > 0
+        ? size_t(hw)
+        : 1;
+  }
+
+  // Calls func(i) for i in [0,count); i == 0 runs on the calling thread
+  template<typename FuncT>
+  void run(const size_t count, const FuncT& func)
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(count);
+    for(size_t i = 1; i < count; i++) {
+      threads.emplace_back([&func, i]() -> void {
+        func(i);
+      });
+    }
+
+    func(0);
+
+    for(std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  // Runs tasks, which may push further tasks, on a fixed set of threads;
+  // the thread constructing the queue and calling wait() is one of them.
+  //
+  // NOTE: Every thread owns a deque: tasks pushed by a task go to its own
+  //       thread's deque and are run last in, first out, keeping the
+  //       working set small. Idle threads steal the oldest tasks of the
+  //       others, which tend to be the largest.
+  class TaskQueue {
+  public:
+    typedef std::function<void()> Task;
+
+    explicit TaskQueue(const size_t numThreads)
+      : _workers(numThreads > 0  ?  numThreads : 1)
+      , _numQueued(0)
+      , _numPending(0)
+      , _isStopping(false)
+      , _outerSlot(threadSlot())
+    {
+      threadSlot() = ThreadSlot{this, 0};
+
+      for(size_t i = 1; i < _workers.size(); i++) {
+        _threads.emplace_back([this, i]() -> void {
+          work(i);
+        });
+      }
+    }
+
+    ~TaskQueue()
+    {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+      }
+      _wakeup.notify_all();
+
+      for(std::thread& thread : _threads) {
+        thread.join();
+      }
+
+      threadSlot() = _outerSlot;
+    }
+
+    void push(Task task)
+    {
+      const ThreadSlot& slot = threadSlot();
+      Worker& worker = _workers[slot.queue == this  ?  slot.index : 0];
+
+      // NOTE: Counting first; a task may be stolen & finished at once.
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _numQueued++;
+        _numPending++;
+      }
+      {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(std::move(task));
+      }
+      _wakeup.notify_one();
+    }
+
+    // Helps running the tasks until all of them, including the ones pushed
+    // meanwhile, are finished
+    void wait()
+    {
+      Task task;
+      while( true ) {
+        if( take(0, &task) ) {
+          run(&task);
+          continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _wakeup.wait(lock, [this]() -> bool {
+          return _numQueued > 0  ||  _numPending == 0;
+        });
+        if( _numPending == 0 ) {
+          return;
+        }
+      }
+    }
+
+  private:
+    TaskQueue(const TaskQueue&) = delete;
+    TaskQueue& operator=(const TaskQueue&) = delete;
+
+    struct alignas(64) Worker {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    // The calling thread's deque, if it belongs to queue
+    struct ThreadSlot {
+      const TaskQueue *queue;
+      size_t index;
+    };
+
+    static ThreadSlot& threadSlot()
+    {
+      static thread_local ThreadSlot slot{0, 0};
+      return slot;
+    }
+
+    // Pops the newest own task or steals the oldest task of another thread
+    bool take(const size_t index, Task *task)
+    {
+      const size_t numWorkers = _workers.size();
+      for(size_t k = 0; k < numWorkers; k++) {
+        Worker& worker = _workers[(index + k) % numWorkers];
+
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if( worker.tasks.empty() ) {
+          continue;
+        }
+        if( k == 0 ) {
+          *task = std::move(worker.tasks.back());
+          worker.tasks.pop_back();
+        } else {
+          *task = std::move(worker.tasks.front());
+          worker.tasks.pop_front();
+        }
+        _numQueued--;
+        return true;
+      }
+      return false;
+    }
+
+    void run(Task *task)
+    {
+      (*task)();
+      *task = nullptr;
+
+      if( _numPending.fetch_sub(1) == 1 ) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _wakeup.notify_all();
+      }
+    }
+
+    void work(const size_t index)
+    {
+      threadSlot() = ThreadSlot{this, index};
+
+      Task task;
+      while( true ) {
+        if( take(index, &task) ) {
+          run(&task);
+          continue;
+        }
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        _wakeup.wait(lock, [this]() -> bool {
+          return _numQueued > 0  ||  _isStopping;
+        });
+        if( _isStopping ) {
+          return;
+        }
+      }
+    }
+
+    std::vector<Worker> _workers;
+    std::mutex _mutex; // guards sleeping, i.e. increments & _isStopping
+    std::condition_variable _wakeup;
+    std::atomic<size_t> _numQueued;
+    std::atomic<size_t> _numPending;
+    bool _isStopping;
+    const ThreadSlot _outerSlot;
+    std::vector<std::thread> _threads;
+  };
+
+}; // namespace priv_parallel
+
+#endif // __PARALLEL_H__
@@ -0,0 +1,284 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __SIMD_STRING_H__
+#define __SIMD_STRING_H__
+
+#include <csCore2/cscore2_config.h>
+
+#include "internal/cpu.h"
+
+#ifdef CS_ARCH_X64
+# include <emmintrin.h>
+#endif
+
+namespace priv_simd {
+
+  template<size_t SIZE>
+  struct CharBits {
+    // SFINAE
+  };
+
+  template<>
+  struct CharBits<1> {
+    typedef uint8_t type;
+  };
+
+  template<>
+  struct CharBits<2> {
+    typedef uint16_t type;
+  };
+
+  template<>
+  struct CharBits<4> {
+    typedef uint32_t type;
+  };
+
+  // Index of the first zero element of s, but no more than maxcount.
+  // NOTE: Vector loads are aligned & never cross a page boundary.
+  size_t findZero(const uint8_t  *s, const size_t maxcount);
+  size_t findZero(const uint16_t *s, const size_t maxcount);
+  size_t findZero(const uint32_t *s, const size_t maxcount);
+
+#ifdef CS_ARCH_X64
+  // Like findZero(), if s ends within its first 32 bytes; returns false
+  // otherwise. Inlined, short strings are found without calling through
+  // the kernel pointer. SSE2 is part of x86-64.
+  template<typename T>
+  inline bool findZeroShort(const T *s, const size_t maxcount, size_t *index)
+  {
+    const size_t SHORT_BYTES = 32;
+
+    if( (reinterpret_cast<uintptr_t>(s) & (sizeof(T) - 1)) != 0  ||
+        !priv_cpu::isPageSafe(s, SHORT_BYTES) ) {
+      return false;
+    }
+
+    const __m128i *p    = reinterpret_cast<const __m128i*>(s);
+    const __m128i  lo   = _mm_loadu_si128(p);
+    const __m128i  hi   = _mm_loadu_si128(p + 1);
+    const __m128i  zero = _mm_setzero_si128();
+    uint32_t mask;
+    if(        sizeof(T) == 1 ) {
+      mask = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(lo, zero))) |
+          uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(hi, zero))) << 16;
+    } else if( sizeof(T) == 2 ) {
+      mask = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi16(lo, zero))) |
+          uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi16(hi, zero))) << 16;
+    } else {
+      mask = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi32(lo, zero))) |
+          uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi32(hi, zero))) << 16;
+    }
+    if( mask == 0 ) {
+      return false;
+    }
+
+    const size_t i = size_t(priv_cpu::ctz32(mask))/sizeof(T);
+    *index = i < maxcount
+        ? i
+        : maxcount;
+    return true;
+  }
+#endif
+
+  // Index of the first element, where s1 and s2 differ or s1 terminates,
+  // but no more than maxcount; ignoreCase folds 'A'-'Z' like csToLower().
+  size_t findMismatch(const uint8_t  *s1, const uint8_t  *s2, const size_t maxcount, const bool ignoreCase);
+  size_t findMismatch(const uint16_t *s1, const uint16_t *s2, const size_t maxcount, const bool ignoreCase);
+  size_t findMismatch(const uint32_t *s1, const uint32_t *s2, const size_t maxcount, const bool ignoreCase);
+
+  // Index of the first element, where s1 and s2 differ, or len;
+  // unlike findMismatch() zero elements are compared like any other.
+  size_t findDifference(const uint8_t  *s1, const uint8_t  *s2, const size_t len, const bool ignoreCase);
+  size_t findDifference(const uint16_t *s1, const uint16_t *s2, const size_t len, const bool ignoreCase);
+  size_t findDifference(const uint32_t *s1, const uint32_t *s2, const size_t len, const bool ignoreCase);
+
+  // Index of the first element of s (not) contained in set, or SIZE_MAX.
+  size_t findFirstOf(const uint8_t  *s, const size_t len, const uint8_t  *set, const size_t setLen);
+  size_t findFirstOf(const uint16_t *s, const size_t len, const uint16_t *set, const size_t setLen);
+  size_t findFirstOf(const uint32_t *s, const size_t len, const uint32_t *set, const size_t setLen);
+
+  size_t findFirstNotOf(const uint8_t  *s, const size_t len, const uint8_t  *set, const size_t setLen);
+  size_t findFirstNotOf(const uint16_t *s, const size_t len, const uint16_t *set, const size_t setLen);
+  size_t findFirstNotOf(const uint32_t *s, const size_t len, const uint32_t *set, const size_t setLen);
+
+  // Index of the first (last) occurrence of needle in hay, or SIZE_MAX;
+  // short needles are located by vectorized first & last character
+  // filtering, long needles by Two-Way matching.
+  size_t findSubstring(const uint8_t  *hay, const size_t hayLen, const uint8_t  *needle, const size_t needleLen, const bool ignoreCase);
+  size_t findSubstring(const uint16_t *hay, const size_t hayLen, const uint16_t *needle, const size_t needleLen, const bool ignoreCase);
+  size_t findSubstring(const uint32_t *hay, const size_t hayLen, const uint32_t *needle, const size_t needleLen, const bool ignoreCase);
+
+  size_t findLastSubstring(const uint8_t  *hay, const size_t hayLen, const uint8_t  *needle, const size_t needleLen, const bool ignoreCase);
+  size_t findLastSubstring(const uint16_t *hay, const size_t hayLen, const uint16_t *needle, const size_t needleLen, const bool ignoreCase);
+  size_t findLastSubstring(const uint32_t *hay, const size_t hayLen, const uint32_t *needle, const size_t needleLen, const bool ignoreCase);
+
+  // Number of (overlapping) occurrences of needle in hay.
+  size_t countSubstring(const uint8_t  *hay, const size_t hayLen, const uint8_t  *needle, const size_t needleLen, const bool ignoreCase);
+  size_t countSubstring(const uint16_t *hay, const size_t hayLen, const uint16_t *needle, const size_t needleLen, const bool ignoreCase);
+  size_t countSubstring(const uint32_t *hay, const size_t hayLen, const uint32_t *needle, const size_t needleLen, const bool ignoreCase);
+
+  // Bit i is set if s[i] is an element of set, for i < min(len, 64);
+  // sets larger than 16 elements are matched by scalar code.
+  uint64_t matchSet(const uint8_t  *s, const size_t len, const uint8_t  *set, const size_t setLen);
+  uint64_t matchSet(const uint16_t *s, const size_t len, const uint16_t *set, const size_t setLen);
+  uint64_t matchSet(const uint32_t *s, const size_t len, const uint32_t *set, const size_t setLen);
+
+  // Replaces all elements of s equal to before with after.
+  void replaceChar(uint8_t  *s, const size_t len, const uint8_t  before, const uint8_t  after, const bool ignoreCase);
+  void replaceChar(uint16_t *s, const size_t len, const uint16_t before, const uint16_t after, const bool ignoreCase);
+  void replaceChar(uint32_t *s, const size_t len, const uint32_t before, const uint32_t after, const bool ignoreCase);
+
+  // Maps 'A'-'Z' to 'a'-'z' (or vice versa) in place, like csToLower() (csToUpper()).
+  void toLower(uint8_t  *s, const size_t len);
+  void toLower(uint16_t *s, const size_t len);
+  void toLower(uint32_t *s, const size_t len);
+
+  void toUpper(uint8_t  *s, const size_t len);
+  void toUpper(uint16_t *s, const size_t len);
+  void toUpper(uint32_t *s, const size_t len);
+
+  template<typename CharT>
+  inline size_t stringFind(const CharT *hay, const size_t hayLen,
+                           const CharT *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return findSubstring(reinterpret_cast<const bits_t*>(hay), hayLen,
+                         reinterpret_cast<const bits_t*>(needle), needleLen, ignoreCase);
+  }
+
+  template<typename CharT>
+  inline size_t stringFindLast(const CharT *hay, const size_t hayLen,
+                               const CharT *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return findLastSubstring(reinterpret_cast<const bits_t*>(hay), hayLen,
+                             reinterpret_cast<const bits_t*>(needle), needleLen, ignoreCase);
+  }
+
+  template<typename CharT>
+  inline size_t stringCount(const CharT *hay, const size_t hayLen,
+                            const CharT *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return countSubstring(reinterpret_cast<const bits_t*>(hay), hayLen,
+                          reinterpret_cast<const bits_t*>(needle), needleLen, ignoreCase);
+  }
+
+  template<typename CharT>
+  inline size_t stringFindFirstOf(const CharT *s, const size_t len,
+                                  const CharT *set, const size_t setLen)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return findFirstOf(reinterpret_cast<const bits_t*>(s), len,
+                       reinterpret_cast<const bits_t*>(set), setLen);
+  }
+
+  template<typename CharT>
+  inline size_t stringFindFirstNotOf(const CharT *s, const size_t len,
+                                     const CharT *set, const size_t setLen)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return findFirstNotOf(reinterpret_cast<const bits_t*>(s), len,
+                          reinterpret_cast<const bits_t*>(set), setLen);
+  }
+
+  template<typename CharT>
+  inline uint64_t stringMatchSet(const CharT *s, const size_t len,
+                                 const CharT *set, const size_t setLen)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return matchSet(reinterpret_cast<const bits_t*>(s), len,
+                    reinterpret_cast<const bits_t*>(set), setLen);
+  }
+
+  template<typename CharT>
+  inline size_t stringMismatch(const CharT *s1, const CharT *s2, const size_t maxcount,
+                               const bool ignoreCase)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return findMismatch(reinterpret_cast<const bits_t*>(s1), reinterpret_cast<const bits_t*>(s2),
+                        maxcount, ignoreCase);
+  }
+
+  template<typename CharT>
+  inline size_t stringDifference(const CharT *s1, const CharT *s2, const size_t len,
+                                 const bool ignoreCase)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    return findDifference(reinterpret_cast<const bits_t*>(s1), reinterpret_cast<const bits_t*>(s2),
+                          len, ignoreCase);
+  }
+
+  template<typename CharT>
+  inline void stringReplace(CharT *s, const size_t len, const CharT before, const CharT after,
+                            const bool ignoreCase)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    replaceChar(reinterpret_cast<bits_t*>(s), len, bits_t(before), bits_t(after), ignoreCase);
+  }
+
+  template<typename CharT>
+  inline void stringToLower(CharT *s, const size_t len)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    toLower(reinterpret_cast<bits_t*>(s), len);
+  }
+
+  template<typename CharT>
+  inline void stringToUpper(CharT *s, const size_t len)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+    toUpper(reinterpret_cast<bits_t*>(s), len);
+  }
+
+  template<typename CharT>
+  inline size_t stringNLen(const CharT *s, const size_t maxcount)
+  {
+    typedef typename CharBits<sizeof(CharT)>::type bits_t;
+#ifdef CS_ARCH_X64
+    size_t index;
+    if( findZeroShort(reinterpret_cast<const bits_t*>(s), maxcount, &index) ) {
+      return index;
+    }
+#endif
+    return findZero(reinterpret_cast<const bits_t*>(s), maxcount);
+  }
+
+  template<typename CharT>
+  inline size_t stringLen(const CharT *s)
+  {
+    return stringNLen(s, SIZE_MAX);
+  }
+
+}; // namespace priv_simd
+
+#endif // __SIMD_STRING_H__
@@ -0,0 +1,197 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __TWOWAY_H__
+#define __TWOWAY_H__
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csUtil.h>
+
+// Crochemore-Perrin Two-Way string matching; O(n+m) time, O(1) space.
+// Cf. M. Crochemore, D. Perrin, "Two-way string-matching", J. ACM 38(3), 1991
+
+namespace priv_twoway {
+
+  template<typename T>
+  struct Forward {
+    Forward(const T *p, const size_t /*n*/)
+      : _p(p)
+    {
+    }
+
+    inline T operator[](const size_t i) const
+    {
+      return _p[i];
+    }
+
+    const T *_p;
+  };
+
+  template<typename T>
+  struct Reverse {
+    Reverse(const T *p, const size_t n)
+      : _p(p + n - 1)
+    {
+    }
+
+    inline T operator[](const size_t i) const
+    {
+      return *(_p - i);
+    }
+
+    const T *_p;
+  };
+
+  template<typename T, bool IGNORE_CASE>
+  inline T canon(const T x)
+  {
+    if( IGNORE_CASE ) {
+      return T(x - T('A')) < T(26)
+          ? T(x + T(0x20))
+          : x;
+    }
+    return x;
+  }
+
+  template<typename T, bool IGNORE_CASE, typename SeqT>
+  size_t maxSuffix(const SeqT& x, const size_t m, size_t *period, const bool reverseOrder)
+  {
+    size_t ms = SIZE_MAX; // NOTE: ms+k wraps around to k-1 initially
+    size_t j  = 0;
+    size_t k  = 1;
+    size_t p  = 1;
+    while( j + k < m ) {
+      const T a = canon<T,IGNORE_CASE>(x[j + k]);
+      const T b = canon<T,IGNORE_CASE>(x[ms + k]);
+      if( reverseOrder  ?  b < a : a < b ) {
+        j += k;
+        k  = 1;
+        p  = j - ms;
+      } else if( a == b ) {
+        if( k != p ) {
+          k++;
+        } else {
+          j += p;
+          k  = 1;
+        }
+      } else {
+        ms = j++;
+        k  = p = 1;
+      }
+    }
+    *period = p;
+    return ms;
+  }
+
+  // Returns the critical position of the needle; period receives its period.
+  template<typename T, bool IGNORE_CASE, typename SeqT>
+  size_t criticalFactorization(const SeqT& needle, const size_t m, size_t *period)
+  {
+    size_t p1, p2;
+    const size_t ms1 = maxSuffix<T,IGNORE_CASE>(needle, m, &p1, false);
+    const size_t ms2 = maxSuffix<T,IGNORE_CASE>(needle, m, &p2, true);
+    if( ms2 + 1 < ms1 + 1 ) {
+      *period = p1;
+      return ms1 + 1;
+    }
+    *period = p2;
+    return ms2 + 1;
+  }
+
+  // Reports every (overlapping) occurrence of needle to found(j), which
+  // returns false to stop the search; requires 0 < m <= n.
+  template<typename T, bool IGNORE_CASE, typename SeqT, typename FoundT>
+  void search(const SeqT& hay, const size_t n, const SeqT& needle, const size_t m,
+              FoundT found)
+  {
+    size_t period;
+    const size_t suffix = criticalFactorization<T,IGNORE_CASE>(needle, m, &period);
+
+    bool isPeriodic = true;
+    for(size_t i = 0; i < suffix; i++) {
+      if( canon<T,IGNORE_CASE>(needle[i]) != canon<T,IGNORE_CASE>(needle[i + period]) ) {
+        isPeriodic = false;
+        break;
+      }
+    }
+
+    if( isPeriodic ) {
+      size_t memory = 0;
+      size_t j      = 0;
+      while( j <= n - m ) {
+        size_t i = csMax(suffix, memory);
+        while( i < m  &&  canon<T,IGNORE_CASE>(needle[i]) == canon<T,IGNORE_CASE>(hay[i + j]) ) {
+          i++;
+        }
+        if( i >= m ) {
+          i = suffix - 1;
+          while( memory < i + 1  &&  canon<T,IGNORE_CASE>(needle[i]) == canon<T,IGNORE_CASE>(hay[i + j]) ) {
+            i--;
+          }
+          if( i + 1 < memory + 1  &&  !found(j) ) {
+            return;
+          }
+          j      += period;
+          memory  = m - period;
+        } else {
+          j      += i - suffix + 1;
+          memory  = 0;
+        }
+      }
+
+    } else {
+      period = csMax(suffix, m - suffix) + 1;
+      size_t j = 0;
+      while( j <= n - m ) {
+        size_t i = suffix;
+        while( i < m  &&  canon<T,IGNORE_CASE>(needle[i]) == canon<T,IGNORE_CASE>(hay[i + j]) ) {
+          i++;
+        }
+        if( i >= m ) {
+          i = suffix - 1;
+          while( i != SIZE_MAX  &&  canon<T,IGNORE_CASE>(needle[i]) == canon<T,IGNORE_CASE>(hay[i + j]) ) {
+            i--;
+          }
+          if( i == SIZE_MAX  &&  !found(j) ) {
+            return;
+          }
+          j += period;
+        } else {
+          j += i - suffix + 1;
+        }
+      }
+    }
+  }
+
+}; // namespace priv_twoway
+
+#endif // __TWOWAY_H__
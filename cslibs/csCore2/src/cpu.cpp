@@ -0,0 +1,123 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "internal/cpu.h"
+
+#if defined(CS_ARCH_X86) && !defined(_MSC_VER)
+# include <cpuid.h>
+#endif
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_cpu {
+
+#ifdef CS_ARCH_X86
+
+  inline void cpuid(uint32_t regs[4], const uint32_t leaf, const uint32_t subleaf)
+  {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuidex(info, int(leaf), int(subleaf));
+    for(int i = 0; i < 4; i++) {
+      regs[i] = uint32_t(info[i]);
+    }
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+  }
+
+  inline uint64_t xgetbv0()
+  {
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    uint32_t eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (uint64_t(edx) << 32) | eax;
+#endif
+  }
+
+  Level detectLevel()
+  {
+    uint32_t regs[4];
+
+    cpuid(regs, 0, 0);
+    const uint32_t maxLeaf = regs[0];
+
+    cpuid(regs, 1, 0);
+    const bool haveSSE2    = (regs[3] & (1u << 26)) != 0;
+    const bool haveOSXSAVE = (regs[2] & (1u << 27)) != 0;
+    if( !haveSSE2 ) {
+      return Scalar;
+    }
+    if( !haveOSXSAVE  ||  maxLeaf < 7 ) {
+      return SSE2;
+    }
+
+    // OS saves XMM & YMM state (XCR0 bits 1 & 2)?
+    const uint64_t xcr0 = xgetbv0();
+    if( (xcr0 & 0x06) != 0x06 ) {
+      return SSE2;
+    }
+
+    cpuid(regs, 7, 0);
+    const bool haveAVX2     = (regs[1] & (1u <<  5)) != 0;
+    const bool haveBMI1     = (regs[1] & (1u <<  3)) != 0;
+    const bool haveAVX512F  = (regs[1] & (1u << 16)) != 0;
+    const bool haveAVX512BW = (regs[1] & (1u << 30)) != 0;
+    if( !haveAVX2  ||  !haveBMI1 ) {
+      return SSE2;
+    }
+
+    // OS saves opmask & ZMM state (XCR0 bits 5, 6 & 7)?
+    if( haveAVX512F  &&  haveAVX512BW  &&  (xcr0 & 0xE0) == 0xE0 ) {
+      return AVX512;
+    }
+
+    return AVX2;
+  }
+
+#else
+
+  Level detectLevel()
+  {
+    return Scalar;
+  }
+
+#endif
+
+  Level level()
+  {
+    static const Level cpuLevel = detectLevel();
+    return cpuLevel;
+  }
+
+}; // namespace priv_cpu
@@ -29,108 +29,708 @@
 ** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *****************************************************************************/
 
+#include <cmath>
+#include <cstring>
+
+#include <limits>
+#include <string>
+#include <type_traits>
+
 #include "csCore2/csAlphaNum.h"
 
 #include "csCore2/csLimits.h"
 
+#include "internal/floatconv.h"
+#include "internal/simd_string.h"
+
 ////// Private ///////////////////////////////////////////////////////////////
 
 namespace priv_alphanum {
 
+  const char DIGITS_100[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+  const char DIGITS_36[37] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+  const uint32_t NO_DIGIT = 0xFF;
+
+  inline bool isValidBase(const int base)
+  {
+    return 2 <= base  &&  base <= 36;
+  }
+
   template<typename CharT>
-  inline CharT toChar(const uint32_t digit)
+  inline uint32_t toDigit(const CharT ch)
   {
-    if(         0 <= digit  &&  digit <=  9 ) {
-      return CharT('0')+(CharT)digit;
-    } else if( 10 <= digit  &&  digit <  36 ) {
-      return CharT('a')+(CharT)(digit-10);
+    const uint32_t c = uint32_t(typename std::make_unsigned<CharT>::type(ch));
+    if(        c - uint32_t('0') < 10 ) {
+      return c - uint32_t('0');
+    } else if( (c | 0x20) - uint32_t('a') < 26 ) {
+      return (c | 0x20) - uint32_t('a') + 10;
     }
-    return CharT(0);
+    return NO_DIGIT;
   }
 
-  template<typename CharT>
-  inline int toDigit(const CharT ch, const int base)
+  ////// Formatting //////////////////////////////////////////////////////////
+
+  template<typename U>
+  inline int countDigits10(U v)
   {
-    int dig = -1;
-    if(        (int)'0' <= (int)ch  &&  (int)ch <= (int)'9' ) {
-      dig = (int)ch - (int)'0';
-    } else if( (int)'a' <= (int)ch  &&  (int)ch <= (int)'z' ) {
-      dig = (int)ch - (int)'a' + 10;
-    } else if( (int)'A' <= (int)ch  &&  (int)ch <= (int)'Z' ) {
-      dig = (int)ch - (int)'A' + 10;
+    int n = 1;
+    for(;;) {
+      if( v < 10 ) {
+        return n;
+      } else if( v < 100 ) {
+        return n + 1;
+      } else if( v < 1000 ) {
+        return n + 2;
+      } else if( v < 10000 ) {
+        return n + 3;
+      }
+      v /= 10000;
+      n += 4;
     }
-    if( dig >= base ) {
-      return -1;
+  }
+
+  template<typename U>
+  inline int countDigits(U v, const int base)
+  {
+    if( base == 10 ) {
+      return countDigits10(v);
     }
-    return dig;
+    int n = 1;
+    if( base == 16 ) {
+      while( (v >>= 4) != 0 ) {
+        n++;
+      }
+    } else {
+      while( (v /= U(base)) != 0 ) {
+        n++;
+      }
+    }
+    return n;
   }
 
-#define BASE  ((uint32_t)base)
-#define DIG   ((uint32_t)dig)
+  // Writes the digits of v backwards, ending just before end
+  template<typename CharT, typename U>
+  inline void writeDigits10(CharT *end, U v)
+  {
+    while( v >= 100 ) {
+      const char *d = DIGITS_100 + 2*(v % 100);
+      v /= 100;
+      end -= 2;
+      end[0] = CharT(d[0]);
+      end[1] = CharT(d[1]);
+    }
+    if( v >= 10 ) {
+      const char *d = DIGITS_100 + 2*v;
+      end[-2] = CharT(d[0]);
+      end[-1] = CharT(d[1]);
+    } else {
+      end[-1] = CharT('0' + v);
+    }
+  }
 
-  template<typename CharT>
-  inline CharT *toStr(CharT *s, const size_t maxsize, const uint32_t num,
-                      const int base)
+  template<typename CharT, typename U>
+  inline void writeDigits(CharT *end, U v, const int base)
   {
-    if( base < 2  ||  base > 36 ) {
-      return 0;
+    if( base == 10 ) {
+      // 32bit divisions are cheaper
+      if( sizeof(U) > sizeof(uint32_t)  &&  v <= U(csLimits<uint32_t>::Max) ) {
+        writeDigits10(end, uint32_t(v));
+      } else {
+        writeDigits10(end, v);
+      }
+    } else if( base == 16 ) {
+      do {
+        *--end = CharT(DIGITS_36[v & 0xF]);
+        v >>= 4;
+      } while( v != 0 );
+    } else {
+      do {
+        *--end = CharT(DIGITS_36[v % U(base)]);
+        v /= U(base);
+      } while( v != 0 );
     }
+  }
 
-    uint32_t compnum = num;
-    size_t   reqsize = 0;
-    do {
-      reqsize++;
-      compnum /= BASE;
-    } while( compnum != 0 );
+  template<typename CharT, typename T>
+  inline csToCharsResult<CharT> toChars(CharT *first, CharT *last, const T value,
+                                        const int base)
+  {
+    using U = typename std::make_unsigned<T>::type;
 
-    if( reqsize+1 > maxsize ) {
-      return 0;
+    if( first == 0  ||  last < first  ||  !isValidBase(base) ) {
+      return csToCharsResult<CharT>{first, csNumInvalidArgument};
     }
 
-    s[reqsize] = CharT(0);
+    const bool isNegative = value < 0;
+    const U    magnitude  = isNegative
+        ? U(U(0) - U(value))
+        : U(value);
 
-    compnum = num;
-    size_t i = 0;
-    do {
-      s[reqsize-i-1] = toChar<CharT>(compnum % BASE);
+    const int numDigits = countDigits(magnitude, base);
+    if( last - first < numDigits + int(isNegative) ) {
+      return csToCharsResult<CharT>{last, csNumValueTooLarge};
+    }
 
-      i++;
-      compnum /= BASE;
-    } while( compnum != 0 );
+    if( isNegative ) {
+      *first++ = CharT('-');
+    }
+    writeDigits(first + numDigits, magnitude, base);
+
+    return csToCharsResult<CharT>{first + numDigits, csNumNoError};
+  }
 
+  template<typename CharT, typename T>
+  inline CharT *toStr(CharT *s, const size_t maxsize, const T num, const int base)
+  {
+    if( s == 0  ||  maxsize < 1 ) {
+      return 0;
+    }
+    const csToCharsResult<CharT> result = toChars(s, s + maxsize - 1, num, base);
+    if( result.error != csNumNoError ) {
+      return 0;
+    }
+    *result.ptr = CharT(0);
     return s;
   }
 
+  ////// Parsing /////////////////////////////////////////////////////////////
+
+  // Up to this many significant digits cannot overflow an uint64_t
+  const int SAFE_DIGITS_10 = 19;
+  const int SAFE_DIGITS_16 = 16;
+
+  // Little endian: p[0] is the least significant byte
+  inline bool load8(const char *p, uint64_t *chunk)
+  {
+    memcpy(chunk, p, 8);
+    return true;
+  }
+
+  template<typename CharT>
+  inline bool load8(const CharT *p, uint64_t *chunk)
+  {
+    *chunk = 0;
+    for(int i = 0; i < 8; i++) {
+      const uint64_t c = uint64_t(typename std::make_unsigned<CharT>::type(p[i]));
+      if( c > 0x7F ) {
+        return false;
+      }
+      *chunk |= c << 8*i;
+    }
+    return true;
+  }
+
+  inline bool isEightDigits(const uint64_t chunk)
+  {
+    return ( (chunk & 0xF0F0F0F0F0F0F0F0)  |
+             (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4) )
+        == 0x3333333333333333;
+  }
+
+  // SWAR: combines adjacent digits to 2-, 4- and finally one 8-digit value
+  inline uint32_t parseEightDigits(uint64_t chunk)
+  {
+    const uint64_t mask = 0x000000FF000000FF;
+    const uint64_t mul1 = 0x000F424000000064; // 100 + (1000000 << 32)
+    const uint64_t mul2 = 0x0000271000000001; // 1 + (10000 << 32)
+    chunk -= 0x3030303030303030;
+    chunk  = chunk*10 + (chunk >> 8);
+    chunk  = ((chunk & mask)*mul1 + ((chunk >> 16) & mask)*mul2) >> 32;
+    return uint32_t(chunk);
+  }
+
+  // Returns the end of the digits; *magnitude is only valid if !*overflow
+  template<typename CharT>
+  const CharT *parse10(const CharT *p, const CharT *last,
+                       uint64_t *magnitude, bool *overflow)
+  {
+    while( p < last  &&  *p == CharT('0') ) {
+      p++;
+    }
+
+    const CharT *significant = p;
+    uint64_t num = 0;
+
+    uint64_t chunk;
+    while( last - p >= 8  &&  p - significant + 8 <= SAFE_DIGITS_10  &&
+           load8(p, &chunk)  &&  isEightDigits(chunk) ) {
+      num = num*100000000 + parseEightDigits(chunk);
+      p  += 8;
+    }
+
+    uint32_t dig;
+    while( p < last  &&  p - significant < SAFE_DIGITS_10  &&
+           (dig = uint32_t(typename std::make_unsigned<CharT>::type(*p)) - uint32_t('0')) < 10 ) {
+      num = num*10 + dig;
+      p++;
+    }
+
+    const uint64_t max = csLimits<uint64_t>::Max;
+    *overflow = false;
+    while( p < last  &&
+           (dig = uint32_t(typename std::make_unsigned<CharT>::type(*p)) - uint32_t('0')) < 10 ) {
+      if( num > (max - dig)/10 ) {
+        *overflow = true;
+      } else {
+        num = num*10 + dig;
+      }
+      p++;
+    }
+
+    *magnitude = num;
+    return p;
+  }
+
+  template<typename CharT>
+  const CharT *parse16(const CharT *p, const CharT *last,
+                       uint64_t *magnitude, bool *overflow)
+  {
+    while( p < last  &&  *p == CharT('0') ) {
+      p++;
+    }
+
+    const CharT *significant = p;
+    uint64_t num = 0;
+
+    uint32_t dig;
+    while( p < last  &&  (dig = toDigit(*p)) < 16 ) {
+      if( p - significant < SAFE_DIGITS_16 ) {
+        num = (num << 4) | dig;
+      }
+      p++;
+    }
+
+    *overflow  = p - significant > SAFE_DIGITS_16;
+    *magnitude = num;
+    return p;
+  }
+
   template<typename CharT>
-  inline uint32_t toUInt(const CharT *s, bool *ok, const int base,
-                         const uint32_t max)
+  const CharT *parseN(const CharT *p, const CharT *last, const int base,
+                      uint64_t *magnitude, bool *overflow)
+  {
+    const uint64_t max      = csLimits<uint64_t>::Max;
+    const uint64_t mulGuard = max / uint64_t(base);
+    const uint64_t remGuard = max % uint64_t(base);
+
+    uint64_t num = 0;
+    *overflow = false;
+
+    uint32_t dig;
+    while( p < last  &&  (dig = toDigit(*p)) < uint32_t(base) ) {
+      if( num > mulGuard  ||  (num == mulGuard  &&  dig > remGuard) ) {
+        *overflow = true;
+      } else {
+        num = num*uint64_t(base) + dig;
+      }
+      p++;
+    }
+
+    *magnitude = num;
+    return p;
+  }
+
+  template<typename CharT, typename T>
+  inline csFromCharsResult<CharT> fromChars(const CharT *first, const CharT *last,
+                                            T& value, const int base)
+  {
+    using U = typename std::make_unsigned<T>::type;
+
+    if( first == 0  ||  last <= first  ||  !isValidBase(base) ) {
+      return csFromCharsResult<CharT>{first, csNumInvalidArgument};
+    }
+
+    const CharT *p = first;
+    const bool isNegative = std::is_signed<T>::value  &&  *p == CharT('-');
+    if( isNegative ) {
+      p++;
+    }
+
+    uint64_t magnitude;
+    bool     overflow;
+    const CharT *end;
+    if(        base == 10 ) {
+      end = parse10(p, last, &magnitude, &overflow);
+    } else if( base == 16 ) {
+      end = parse16(p, last, &magnitude, &overflow);
+    } else {
+      end = parseN(p, last, base, &magnitude, &overflow);
+    }
+
+    if( end == p ) {
+      return csFromCharsResult<CharT>{first, csNumInvalidArgument};
+    }
+
+    const uint64_t max = isNegative
+        ? uint64_t(csLimits<T>::Max) + 1
+        : uint64_t(csLimits<T>::Max);
+    if( overflow  ||  magnitude > max ) {
+      return csFromCharsResult<CharT>{end, csNumOutOfRange};
+    }
+
+    value = isNegative
+        ? T(U(0) - U(magnitude))
+        : T(magnitude);
+
+    return csFromCharsResult<CharT>{end, csNumNoError};
+  }
+
+  template<typename T, typename CharT>
+  inline T toNumber(const CharT *s, bool *ok, const int base)
   {
     if( ok != 0 ) {
       *ok = false;
     }
 
-    if( s == 0  ||  base < 2  ||  base > 36 ) {
+    if( s == 0 ) {
       return 0;
     }
 
-    const uint32_t mulGuard = max / BASE;
-    const uint32_t remGuard = max % BASE;
+    T num = 0;
+    const csFromCharsResult<CharT> result =
+        fromChars(s, s + priv_simd::stringLen(s), num, base);
+    if( result.error != csNumNoError ) {
+      return 0;
+    }
+
+    if( ok != 0 ) {
+      *ok = true;
+    }
+
+    return num;
+  }
+
+  ////// Floating-point ////////////////////////////////////////////////////
+
+  template<typename CharT>
+  inline CharT *copyAscii(CharT *dest, const char *src, const size_t count)
+  {
+    for(size_t i = 0; i < count; i++) {
+      dest[i] = CharT(src[i]);
+    }
+    return dest + count;
+  }
+
+  template<typename CharT, typename T>
+  inline csToCharsResult<CharT> floatToChars(CharT *first, CharT *last, const T value)
+  {
+    if( first == 0  ||  last < first ) {
+      return csToCharsResult<CharT>{first, csNumInvalidArgument};
+    }
+
+    const bool isNegative = std::signbit(value);
+
+    // Special values & zero
+    const char *special = std::isnan(value)
+        ? "nan"
+        : std::isinf(value)
+          ? "inf"
+          : value == 0
+            ? "0"
+            : 0;
+    if( special != 0 ) {
+      const size_t len = strlen(special);
+      if( size_t(last - first) < len + (isNegative ? 1 : 0) ) {
+        return csToCharsResult<CharT>{last, csNumValueTooLarge};
+      }
+      if( isNegative ) {
+        *first++ = CharT('-');
+      }
+      return csToCharsResult<CharT>{copyAscii(first, special, len), csNumNoError};
+    }
+
+    const priv_floatconv::Decimal dec = priv_floatconv::toDecimal(std::abs(value));
+
+    char digits[20];
+    const int numDigits = countDigits10(dec.significand);
+    writeDigits10(digits + numDigits, dec.significand);
+
+    // Same choice as std::to_chars(): the shorter notation, fixed on a tie
+    const int sciExp = dec.exponent + numDigits - 1;
+    const int absSciExp = sciExp < 0
+        ? -sciExp
+        : sciExp;
+    const int sciLen = numDigits + (numDigits > 1 ? 1 : 0) + 2 +
+        (absSciExp >= 100 ? 3 : 2);
+    const int fixedLen = dec.exponent >= 0
+        ? numDigits + dec.exponent
+        : sciExp >= 0
+          ? numDigits + 1
+          : numDigits + 1 - sciExp;
+    const bool isFixed = fixedLen <= sciLen;
+
+    const int len = (isFixed ? fixedLen : sciLen) + (isNegative ? 1 : 0);
+    if( last - first < len ) {
+      return csToCharsResult<CharT>{last, csNumValueTooLarge};
+    }
+
+    CharT *p = first;
+    if( isNegative ) {
+      *p++ = CharT('-');
+    }
+
+    if( isFixed ) {
+      if(        dec.exponent >= 0 ) { // 12300
+        p = copyAscii(p, digits, size_t(numDigits));
+        std::char_traits<CharT>::assign(p, size_t(dec.exponent), CharT('0'));
+        p += dec.exponent;
+      } else if( sciExp >= 0 ) {       // 12.3
+        p = copyAscii(p, digits, size_t(sciExp + 1));
+        *p++ = CharT('.');
+        p = copyAscii(p, digits + sciExp + 1, size_t(numDigits - sciExp - 1));
+      } else {                         // 0.0123
+        *p++ = CharT('0');
+        *p++ = CharT('.');
+        std::char_traits<CharT>::assign(p, size_t(-sciExp - 1), CharT('0'));
+        p += -sciExp - 1;
+        p = copyAscii(p, digits, size_t(numDigits));
+      }
+    } else {                           // 1.23e+04
+      *p++ = CharT(digits[0]);
+      if( numDigits > 1 ) {
+        *p++ = CharT('.');
+        p = copyAscii(p, digits + 1, size_t(numDigits - 1));
+      }
+      *p++ = CharT('e');
+      *p++ = sciExp < 0
+          ? CharT('-')
+          : CharT('+');
+      if( absSciExp >= 100 ) {
+        *p++ = CharT('0' + absSciExp/100);
+      }
+      p = copyAscii(p, DIGITS_100 + 2*(absSciExp % 100), 2);
+    }
+
+    return csToCharsResult<CharT>{p, csNumNoError};
+  }
+
+  template<typename CharT>
+  inline uint32_t toDecimalDigit(const CharT ch)
+  {
+    return uint32_t(typename std::make_unsigned<CharT>::type(ch)) - uint32_t('0');
+  }
+
+  // Case insensitive; word is lower case
+  template<typename CharT>
+  inline bool startsWithWord(const CharT *p, const CharT *last, const char *word)
+  {
+    for(; *word != '\0'; p++, word++) {
+      if( p >= last  ||  (uint32_t(typename std::make_unsigned<CharT>::type(*p)) | 0x20) != uint32_t(*word) ) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template<typename CharT>
+  inline bool isNanChar(const CharT ch)
+  {
+    const uint32_t c = uint32_t(typename std::make_unsigned<CharT>::type(ch));
+    return c - uint32_t('0') < 10  ||  (c | 0x20) - uint32_t('a') < 26  ||  c == uint32_t('_');
+  }
+
+  // "inf", "infinity", "nan" or "nan(chars)"; returns the end of the match
+  template<typename CharT, typename T>
+  inline const CharT *parseSpecial(const CharT *p, const CharT *last, T *value)
+  {
+    if( startsWithWord(p, last, "inf") ) {
+      *value = std::numeric_limits<T>::infinity();
+      return startsWithWord(p, last, "infinity")
+          ? p + 8
+          : p + 3;
+    }
+
+    if( startsWithWord(p, last, "nan") ) {
+      *value = std::numeric_limits<T>::quiet_NaN();
+      p += 3;
+      if( p < last  &&  *p == CharT('(') ) {
+        const CharT *q = p + 1;
+        while( q < last  &&  isNanChar(*q) ) {
+          q++;
+        }
+        if( q < last  &&  *q == CharT(')') ) {
+          return q + 1;
+        }
+      }
+      return p;
+    }
+
+    return 0;
+  }
+
+  // Slow path; parses all digits
+  template<typename CharT, typename T>
+  T bigDecimalToBinary(const CharT *intBegin, const CharT *intEnd,
+                       const CharT *fracBegin, const CharT *fracEnd,
+                       const int exponent)
+  {
+    priv_floatconv::BigDecimal dec;
+    for(const CharT *p = intBegin; p < intEnd; p++) {
+      dec.appendIntegerDigit(int(toDecimalDigit(*p)));
+    }
+    for(const CharT *p = fracBegin; p < fracEnd; p++) {
+      dec.appendFractionDigit(int(toDecimalDigit(*p)));
+    }
+    dec.addExponent(exponent);
+
+    T value;
+    dec.toBinary(&value);
+    return value;
+  }
+
+  const int MAX_EXPONENT_10 = 100000;
+
+  template<typename CharT, typename T>
+  inline csFromCharsResult<CharT> floatFromChars(const CharT *first, const CharT *last,
+                                                 T& value)
+  {
+    if( first == 0  ||  last <= first ) {
+      return csFromCharsResult<CharT>{first, csNumInvalidArgument};
+    }
+
+    const CharT *p = first;
+    const bool isNegative = *p == CharT('-');
+    if( isNegative ) {
+      p++;
+    }
+
+    if( p < last  &&  toDecimalDigit(*p) >= 10  &&  *p != CharT('.') ) {
+      T special;
+      const CharT *end = parseSpecial(p, last, &special);
+      if( end == 0 ) {
+        return csFromCharsResult<CharT>{first, csNumInvalidArgument};
+      }
+      value = isNegative
+          ? -special
+          : special;
+      return csFromCharsResult<CharT>{end, csNumNoError};
+    }
+
+    // Pattern & significant digits; see parse10()
+    const int SIGNIFICANT_DIGITS = SAFE_DIGITS_10;
 
-    uint32_t num = 0;
+    uint64_t w          = 0;
+    int      numDigits  = 0; // significant digits in w
+    int      exponent   = 0;
+    bool     isTruncated = false;
 
-    int dig;
-    int i = 0;
-    while( (dig = toDigit(s[i++], base)) >= 0 ) {
-      if( num > mulGuard ) {
-        return 0;
+    const CharT *intBegin = p;
+    uint32_t dig;
+    while( p < last  &&  (dig = toDecimalDigit(*p)) < 10 ) {
+      if( numDigits < SIGNIFICANT_DIGITS ) {
+        w = w*10 + dig;
+        numDigits += w != 0 ? 1 : 0;
+      } else {
+        exponent++;
+        isTruncated = isTruncated  ||  dig != 0;
       }
+      p++;
+    }
+    const CharT *intEnd = p;
+
+    const CharT *fracBegin = p;
+    const CharT *fracEnd   = p;
+    if( p < last  &&  *p == CharT('.') ) {
+      fracBegin = ++p;
 
-      if( num == mulGuard  &&  DIG > remGuard ) {
-        return 0;
+      uint64_t chunk;
+      while( numDigits > 0  &&  numDigits + 8 <= SIGNIFICANT_DIGITS  &&  last - p >= 8  &&
+             load8(p, &chunk)  &&  isEightDigits(chunk) ) {
+        w = w*100000000 + parseEightDigits(chunk);
+        numDigits += 8;
+        exponent  -= 8;
+        p += 8;
+      }
+
+      while( p < last  &&  (dig = toDecimalDigit(*p)) < 10 ) {
+        if( numDigits < SIGNIFICANT_DIGITS ) {
+          w = w*10 + dig;
+          numDigits += w != 0 ? 1 : 0;
+          exponent--;
+        } else {
+          isTruncated = isTruncated  ||  dig != 0;
+        }
+        p++;
+      }
+      fracEnd = p;
+    }
+
+    if( intBegin == intEnd  &&  fracBegin == fracEnd ) {
+      return csFromCharsResult<CharT>{first, csNumInvalidArgument};
+    }
+
+    // The exponent is only part of the pattern if it has digits
+    int exponent10 = 0;
+    if( p < last  &&  (uint32_t(typename std::make_unsigned<CharT>::type(*p)) | 0x20) == uint32_t('e') ) {
+      const CharT *q = p + 1;
+      const bool isNegativeExponent = q < last  &&  *q == CharT('-');
+      if( q < last  &&  (*q == CharT('-')  ||  *q == CharT('+')) ) {
+        q++;
+      }
+      if( q < last  &&  toDecimalDigit(*q) < 10 ) {
+        for(; q < last  &&  (dig = toDecimalDigit(*q)) < 10; q++) {
+          if( exponent10 < MAX_EXPONENT_10 ) {
+            exponent10 = exponent10*10 + int(dig);
+          }
+        }
+        if( isNegativeExponent ) {
+          exponent10 = -exponent10;
+        }
+        p = q;
+      }
+    }
+    exponent += exponent10;
+
+    T result;
+    if( w == 0 ) {
+      result = T(0);
+    } else if( !isTruncated ) {
+      if( !priv_floatconv::toBinary(w, exponent, &result) ) {
+        result = bigDecimalToBinary<CharT,T>(intBegin, intEnd, fracBegin, fracEnd, exponent10);
+      }
+    } else {
+      // The exact value lies between w and w + 1
+      T upper;
+      if( !priv_floatconv::toBinary(w, exponent, &result)  ||
+          !priv_floatconv::toBinary(w + 1, exponent, &upper)  ||  result != upper ) {
+        result = bigDecimalToBinary<CharT,T>(intBegin, intEnd, fracBegin, fracEnd, exponent10);
       }
+    }
 
-      num *= BASE;
-      num += DIG;
+    if( std::isinf(result)  ||  (result == 0  &&  w != 0) ) {
+      return csFromCharsResult<CharT>{p, csNumOutOfRange};
+    }
+
+    value = isNegative
+        ? -result
+        : result;
+
+    return csFromCharsResult<CharT>{p, csNumNoError};
+  }
+
+  template<typename T, typename CharT>
+  inline T toFloatingPoint(const CharT *s, bool *ok)
+  {
+    if( ok != 0 ) {
+      *ok = false;
+    }
+
+    if( s == 0 ) {
+      return 0;
+    }
+
+    T num = 0;
+    const csFromCharsResult<CharT> result =
+        floatFromChars(s, s + priv_simd::stringLen(s), num);
+    if( result.error != csNumNoError ) {
+      return 0;
     }
 
     if( ok != 0 ) {
@@ -140,33 +740,222 @@ namespace priv_alphanum {
     return num;
   }
 
-#undef BASE
-#undef DIG
+  template<typename CharT>
+  inline CharT *terminate(CharT *s, const csToCharsResult<CharT>& result)
+  {
+    if( result.error != csNumNoError ) {
+      return 0;
+    }
+    *result.ptr = CharT(0);
+    return s;
+  }
 
 }; // namespace priv_alphanum
 
 ////// Implementation ////////////////////////////////////////////////////////
 
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const int32_t value, const int base)
+{
+  return priv_alphanum::toChars(first, last, value, base);
+}
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const uint32_t value, const int base)
+{
+  return priv_alphanum::toChars(first, last, value, base);
+}
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const int64_t value, const int base)
+{
+  return priv_alphanum::toChars(first, last, value, base);
+}
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const uint64_t value, const int base)
+{
+  return priv_alphanum::toChars(first, last, value, base);
+}
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, int32_t& value, const int base)
+{
+  return priv_alphanum::fromChars(first, last, value, base);
+}
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, uint32_t& value, const int base)
+{
+  return priv_alphanum::fromChars(first, last, value, base);
+}
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, int64_t& value, const int base)
+{
+  return priv_alphanum::fromChars(first, last, value, base);
+}
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, uint64_t& value, const int base)
+{
+  return priv_alphanum::fromChars(first, last, value, base);
+}
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const int32_t num, const int base)
+{
+  return priv_alphanum::toStr(s, maxsize, num, base);
+}
+
 template<typename CharT>
 CharT *csToStr(CharT *s, const size_t maxsize, const uint32_t num, const int base)
 {
   return priv_alphanum::toStr(s, maxsize, num, base);
 }
 
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const int64_t num, const int base)
+{
+  return priv_alphanum::toStr(s, maxsize, num, base);
+}
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const uint64_t num, const int base)
+{
+  return priv_alphanum::toStr(s, maxsize, num, base);
+}
+
+template<typename CharT>
+int32_t csToInt(const CharT *s, bool *ok, const int base)
+{
+  return priv_alphanum::toNumber<int32_t>(s, ok, base);
+}
+
 template<typename CharT>
 uint32_t csToUInt(const CharT *s, bool *ok, const int base)
 {
-  return priv_alphanum::toUInt(s, ok, base, csLimits<uint32_t>::Max);
+  return priv_alphanum::toNumber<uint32_t>(s, ok, base);
+}
+
+template<typename CharT>
+int64_t csToInt64(const CharT *s, bool *ok, const int base)
+{
+  return priv_alphanum::toNumber<int64_t>(s, ok, base);
+}
+
+template<typename CharT>
+uint64_t csToUInt64(const CharT *s, bool *ok, const int base)
+{
+  return priv_alphanum::toNumber<uint64_t>(s, ok, base);
+}
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const float value)
+{
+  return priv_alphanum::floatToChars(first, last, value);
+}
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const double value)
+{
+  return priv_alphanum::floatToChars(first, last, value);
+}
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, float& value)
+{
+  return priv_alphanum::floatFromChars(first, last, value);
+}
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, double& value)
+{
+  return priv_alphanum::floatFromChars(first, last, value);
+}
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const float num)
+{
+  if( s == 0  ||  maxsize < 1 ) {
+    return 0;
+  }
+  return priv_alphanum::terminate(s, priv_alphanum::floatToChars(s, s + maxsize - 1, num));
+}
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const double num)
+{
+  if( s == 0  ||  maxsize < 1 ) {
+    return 0;
+  }
+  return priv_alphanum::terminate(s, priv_alphanum::floatToChars(s, s + maxsize - 1, num));
+}
+
+template<typename CharT>
+float csToFloat(const CharT *s, bool *ok)
+{
+  return priv_alphanum::toFloatingPoint<float>(s, ok);
+}
+
+template<typename CharT>
+double csToDouble(const CharT *s, bool *ok)
+{
+  return priv_alphanum::toFloatingPoint<double>(s, ok);
 }
 
 ////// Explicit instantiation ////////////////////////////////////////////////
 
 #ifdef HAVE_CHAR
+template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const int32_t value, const int base);
+template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const uint32_t value, const int base);
+template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const int64_t value, const int base);
+template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const uint64_t value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, int32_t& value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, uint32_t& value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, int64_t& value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, uint64_t& value, const int base);
+template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const int32_t num, const int base);
 template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const uint32_t num, const int base);
+template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const int64_t num, const int base);
+template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const uint64_t num, const int base);
+template CS_CORE2_EXPORT int32_t csToInt<char>(const char *s, bool *ok, const int base);
 template CS_CORE2_EXPORT uint32_t csToUInt<char>(const char *s, bool *ok, const int base);
+template CS_CORE2_EXPORT int64_t csToInt64<char>(const char *s, bool *ok, const int base);
+template CS_CORE2_EXPORT uint64_t csToUInt64<char>(const char *s, bool *ok, const int base);
+template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const float value);
+template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const double value);
+template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, float& value);
+template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, double& value);
+template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const float num);
+template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const double num);
+template CS_CORE2_EXPORT float csToFloat<char>(const char *s, bool *ok);
+template CS_CORE2_EXPORT double csToDouble<char>(const char *s, bool *ok);
 #endif
 
 #ifdef HAVE_WCHAR_T
+template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const int32_t value, const int base);
+template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const uint32_t value, const int base);
+template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const int64_t value, const int base);
+template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const uint64_t value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, int32_t& value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, uint32_t& value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, int64_t& value, const int base);
+template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, uint64_t& value, const int base);
+template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const int32_t num, const int base);
 template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const uint32_t num, const int base);
+template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const int64_t num, const int base);
+template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const uint64_t num, const int base);
+template CS_CORE2_EXPORT int32_t csToInt<wchar_t>(const wchar_t *s, bool *ok, const int base);
 template CS_CORE2_EXPORT uint32_t csToUInt<wchar_t>(const wchar_t *s, bool *ok, const int base);
+template CS_CORE2_EXPORT int64_t csToInt64<wchar_t>(const wchar_t *s, bool *ok, const int base);
+template CS_CORE2_EXPORT uint64_t csToUInt64<wchar_t>(const wchar_t *s, bool *ok, const int base);
+template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const float value);
+template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const double value);
+template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, float& value);
+template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, double& value);
+template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const float num);
+template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const double num);
+template CS_CORE2_EXPORT float csToFloat<wchar_t>(const wchar_t *s, bool *ok);
+template CS_CORE2_EXPORT double csToDouble<wchar_t>(const wchar_t *s, bool *ok);
 #endif
@@ -31,34 +31,88 @@
 
 #include "csCore2/csChar.h"
 
+#include "internal/simd_string.h"
+#include "internal/unicodecase.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_char {
+
+  wchar_t toLowerUnicode(const wchar_t ch)
+  {
+    return wchar_t(priv_unicodecase::toLower(uint32_t(ch)));
+  }
+
+  wchar_t toUpperUnicode(const wchar_t ch)
+  {
+    return wchar_t(priv_unicodecase::toUpper(uint32_t(ch)));
+  }
+
+  // ASCII is mapped by the vector kernel; remaining characters by table
+  template<bool UPPER>
+  void mapUnicode(wchar_t *s, const size_t len)
+  {
+    if( UPPER ) {
+      priv_simd::stringToUpper(s, len);
+    } else {
+      priv_simd::stringToLower(s, len);
+    }
+
+    for(size_t i = 0; i < len; i++) {
+      if( s[i] >= wchar_t(0x80) ) {
+        s[i] = UPPER
+            ? toUpperUnicode(s[i])
+            : toLowerUnicode(s[i]);
+      }
+    }
+  }
+
+}; // namespace priv_char
+
 ////// Implementation ////////////////////////////////////////////////////////
 
 template<typename CharT>
-CharT csToLower(const CharT ch)
+void csToLower(CharT *s, const size_t len)
 {
-  if( CharT('A') <= ch  &&  ch <= CharT('Z') ) {
-    return (CharT('a') + ch - CharT('A'));
+  if( s == 0 ) {
+    return;
   }
-  return ch;
+  priv_simd::stringToLower(s, len);
 }
 
 template<typename CharT>
-CharT csToUpper(const CharT ch)
+void csToUpper(CharT *s, const size_t len)
+{
+  if( s == 0 ) {
+    return;
+  }
+  priv_simd::stringToUpper(s, len);
+}
+
+void csToLowerUnicode(wchar_t *s, const size_t len)
+{
+  if( s == 0 ) {
+    return;
+  }
+  priv_char::mapUnicode<false>(s, len);
+}
+
+void csToUpperUnicode(wchar_t *s, const size_t len)
 {
-  if( CharT('a') <= ch  &&  ch <= CharT('z') ) {
-    return (CharT('A') + ch - CharT('a'));
+  if( s == 0 ) {
+    return;
   }
-  return ch;
+  priv_char::mapUnicode<true>(s, len);
 }
 
 ////// Explicit instantiation ////////////////////////////////////////////////
 
 #ifdef HAVE_CHAR
-template CS_CORE2_EXPORT char csToLower<char>(const char ch);
-template CS_CORE2_EXPORT char csToUpper<char>(const char ch);
+template CS_CORE2_EXPORT void csToLower<char>(char *s, const size_t len);
+template CS_CORE2_EXPORT void csToUpper<char>(char *s, const size_t len);
 #endif
 
 #ifdef HAVE_WCHAR_T
-template CS_CORE2_EXPORT wchar_t csToLower<wchar_t>(const wchar_t ch);
-template CS_CORE2_EXPORT wchar_t csToUpper<wchar_t>(const wchar_t ch);
+template CS_CORE2_EXPORT void csToLower<wchar_t>(wchar_t *s, const size_t len);
+template CS_CORE2_EXPORT void csToUpper<wchar_t>(wchar_t *s, const size_t len);
 #endif
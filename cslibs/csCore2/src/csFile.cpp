@@ -0,0 +1,293 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "csCore2/csFile.h"
+#include "csCore2/csFlatHash.h"
+#include "csCore2/csGlob.h"
+#include "internal/file.h"
+#include "internal/parallel.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_walk {
+
+  // NOTE: Directories found while this many per thread are queued are
+  //       walked by the finding thread at once, bounding the memory used
+  //       on very wide trees.
+  const size_t MAX_QUEUED_PER_THREAD = 256;
+
+  inline bool isSeparator(const wchar_t ch)
+  {
+    return ch == L'/'  ||  ch == priv_file::SEPARATOR;
+  }
+
+  struct Filter {
+    csGlob<wchar_t> glob;
+    bool isPath; // matches the relative path, otherwise the name
+  };
+
+  bool compile(std::vector<Filter> *filters, const csWStringList& patterns,
+               const bool ignoreCase)
+  {
+    filters->resize(patterns.size());
+
+    size_t i = 0;
+    for(const csWString& pattern : patterns) {
+      Filter& filter = (*filters)[i++];
+      filter.isPath = pattern.find_first_of(L"/\\") != csWString::npos;
+      if( !filter.glob.compile(pattern, ignoreCase) ) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool isMatch(const std::vector<Filter>& filters, const csWalkEntry& entry)
+  {
+    for(const Filter& filter : filters) {
+      const csWStringView& text = filter.isPath
+          ? entry.relativePath
+          : entry.name;
+      if( filter.glob.match(text) ) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  class Walker {
+  public:
+    Walker(const csWalkFunc& func, const csWalkOptions& options)
+      : _func(func)
+      , _options(options)
+      , _queue(0)
+      , _maxQueued(0)
+      , _numQueued(0)
+      , _isStopped(false)
+      , _hasFailed(false)
+    {
+    }
+
+    bool compile()
+    {
+      return
+          priv_walk::compile(&_include, _options.include, _options.ignoreCase)  &&
+          priv_walk::compile(&_exclude, _options.exclude, _options.ignoreCase);
+    }
+
+    bool isStopped() const
+    {
+      return _isStopped;
+    }
+
+    bool hasFailed() const
+    {
+      return _hasFailed;
+    }
+
+    void setQueue(priv_parallel::TaskQueue *queue, const size_t maxQueued)
+    {
+      _queue     = queue;
+      _maxQueued = maxQueued;
+    }
+
+    // Records dir as visited; false if it was visited before.
+    bool visit(const priv_file::NativePath& dir)
+    {
+      if( _options.symLinks != csWalkSymLinksFollow ) {
+        return true;
+      }
+
+      csFileType type;
+      priv_file::FileId id;
+      if( !priv_file::queryTarget(dir, &type, &id) ) {
+        return false;
+      }
+
+      std::lock_guard<std::mutex> lock(_visitedMutex);
+      return _visited.insert(id).second;
+    }
+
+    // Lists dir, whose relative path starts at relBegin; nativeDir is dir
+    // as listed. Returns false if dir cannot be listed completely.
+    bool walk(const std::wstring& dir, const priv_file::NativePath& nativeDir,
+              const size_t relBegin, const int depth)
+    {
+      std::wstring path(dir);
+      priv_file::NativePath nativePath(nativeDir);
+      if( path.empty()  ||  !isSeparator(path.back()) ) {
+        path += priv_file::SEPARATOR;
+        nativePath += priv_file::NativeChar(priv_file::SEPARATOR);
+      }
+      const size_t nameBegin       = path.size();
+      const size_t nativeNameBegin = nativePath.size();
+
+      return priv_file::forEachEntry(nativeDir, [&](const csWStringView& name,
+                                     const priv_file::NativeChar *nativeName,
+                                     const csFileType type) -> bool {
+        if( _isStopped ) {
+          return false;
+        }
+
+        path.resize(nameBegin);
+        path.append(name.data(), name.size());
+        nativePath.resize(nativeNameBegin);
+        nativePath.append(nativeName);
+
+        csWalkEntry entry;
+        entry.path         = csWStringView(path);
+        entry.relativePath = entry.path.mid(int(relBegin));
+        entry.name         = entry.path.mid(int(nameBegin));
+        entry.type         = type;
+        entry.depth        = depth;
+
+        if( type == csFileTypeSymLink ) {
+          if( _options.symLinks == csWalkSymLinksSkip ) {
+            return true;
+          }
+
+          csFileType target;
+          priv_file::FileId id;
+          if( _options.symLinks == csWalkSymLinksFollow  &&
+              priv_file::queryTarget(nativePath, &target, &id) ) {
+            entry.type = target;
+          }
+        }
+
+        if( !_exclude.empty()  &&  isMatch(_exclude, entry) ) {
+          return true;
+        }
+
+        if( _include.empty()  ||  isMatch(_include, entry) ) {
+          if( !_func(entry) ) {
+            _isStopped = true;
+            return false;
+          }
+        }
+
+        const bool isDescending = entry.type == csFileTypeDirectory  &&
+            (_options.maxDepth < 0  ||  depth < _options.maxDepth);
+        if( isDescending  &&  visit(nativePath) ) {
+          descend(path, nativePath, relBegin, depth + 1);
+        }
+
+        return true;
+      });
+    }
+
+  private:
+    Walker(const Walker&) = delete;
+    Walker& operator=(const Walker&) = delete;
+
+    void descend(const std::wstring& dir, const priv_file::NativePath& nativeDir,
+                 const size_t relBegin, const int depth)
+    {
+      if( _queue == 0  ||  _numQueued >= _maxQueued ) {
+        walkSubdirectory(dir, nativeDir, relBegin, depth);
+        return;
+      }
+
+      _numQueued++;
+      _queue->push([this, dir, nativeDir, relBegin, depth]() -> void {
+        _numQueued--;
+        walkSubdirectory(dir, nativeDir, relBegin, depth);
+      });
+    }
+
+    // A failing subdirectory fails the walk, which goes on nevertheless.
+    void walkSubdirectory(const std::wstring& dir, const priv_file::NativePath& nativeDir,
+                          const size_t relBegin, const int depth)
+    {
+      if( !walk(dir, nativeDir, relBegin, depth)  &&  !_isStopped ) {
+        _hasFailed = true;
+      }
+    }
+
+    const csWalkFunc& _func;
+    const csWalkOptions& _options;
+    std::vector<Filter> _include;
+    std::vector<Filter> _exclude;
+    priv_parallel::TaskQueue *_queue;
+    size_t _maxQueued;
+    std::atomic<size_t> _numQueued;
+    std::atomic<bool> _isStopped;
+    std::atomic<bool> _hasFailed;
+    std::mutex _visitedMutex;
+    csFlatHashSet<priv_file::FileId,priv_file::FileIdHash> _visited;
+  };
+
+}; // namespace priv_walk
+
+////// Implementation ////////////////////////////////////////////////////////
+
+CS_CORE2_EXPORT bool csWalkDirectory(const wchar_t *root, const csWalkFunc& func,
+                                     const csWalkOptions& options)
+{
+  if( root == 0  ||  *root == L'\0'  ||  !func ) {
+    return false;
+  }
+
+  priv_walk::Walker walker(func, options);
+  if( !walker.compile() ) {
+    return false;
+  }
+
+  const std::wstring dir(root);
+  const size_t relBegin = priv_walk::isSeparator(dir.back())
+      ? dir.size()
+      : dir.size() + 1;
+
+  priv_file::NativePath nativeDir;
+  if( !priv_file::toNative(&nativeDir, dir) ) {
+    return false;
+  }
+
+  walker.visit(nativeDir);
+
+  const size_t numThreads = priv_parallel::threadCount(options.threadCount);
+  if( numThreads < 2 ) {
+    const bool result = walker.walk(dir, nativeDir, relBegin, 0);
+    return result  &&  !walker.isStopped()  &&  !walker.hasFailed();
+  }
+
+  priv_parallel::TaskQueue queue(numThreads);
+  walker.setQueue(&queue, numThreads*priv_walk::MAX_QUEUED_PER_THREAD);
+  const bool result = walker.walk(dir, nativeDir, relBegin, 0);
+  queue.wait();
+
+  return result  &&  !walker.isStopped()  &&  !walker.hasFailed();
+}
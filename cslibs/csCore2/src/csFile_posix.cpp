@@ -0,0 +1,509 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "csCore2/csFile.h"
+#include "csCore2/csGlob.h"
+#include "csCore2/csUtf.h"
+#include "csCore2/csUtil.h"
+#include "internal/file.h"
+
+#ifdef CS_OS_LINUX
+# include <sys/syscall.h>
+# include <sys/sysmacros.h>
+#endif
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_file {
+
+  // NOTE: readdir() fetches 32KiB per system call; on Linux, larger
+  //       batches save most of the system calls when listing directories
+  //       with many entries. A walk keeps one batch per thread and level
+  //       of nested listing.
+  const size_t BATCH_SIZE      = 1024*1024;
+  const size_t WALK_BATCH_SIZE = 64*1024;
+
+  // NOTE: The smallest record of ext4 holds 8 bytes of header and a name of
+  //       up to 4 bytes. Implausibly large directories are not estimated.
+  const size_t MIN_RECORD_SIZE   = 12;
+  const size_t MAX_ESTIMATE_SIZE = 256*1024*1024;
+
+#ifdef CS_OS_LINUX
+  // The record returned by getdents64(2); older C libraries lack a wrapper.
+  struct linux_dirent64 {
+    uint64_t       d_ino;
+    int64_t        d_off;
+    unsigned short d_reclen;
+    unsigned char  d_type;
+    char           d_name[1];
+  };
+#endif
+
+  csFileType fileType(const unsigned char d_type)
+  {
+    if(        d_type == DT_UNKNOWN ) {
+      return csFileTypeUnknown;
+    } else if( d_type == DT_REG ) {
+      return csFileTypeFile;
+    } else if( d_type == DT_DIR ) {
+      return csFileTypeDirectory;
+    } else if( d_type == DT_LNK ) {
+      return csFileTypeSymLink;
+    }
+    return csFileTypeOther;
+  }
+
+  // Queries only the file type and, if requested, the identity; flags are
+  // AT_* flags.
+  bool statFile(const int dirfd, const char *name, const int flags,
+                mode_t *mode, FileId *id = 0)
+  {
+#ifdef STATX_TYPE
+    struct statx stx;
+    const unsigned int mask = id != 0
+        ? STATX_TYPE | STATX_INO
+        : STATX_TYPE;
+    if( statx(dirfd, name, flags | AT_STATX_DONT_SYNC, mask, &stx) == 0 ) {
+      *mode = stx.stx_mode;
+      if( id != 0 ) {
+        id->volume = makedev(stx.stx_dev_major, stx.stx_dev_minor);
+        id->index  = stx.stx_ino;
+      }
+      return true;
+    }
+    if( errno != ENOSYS ) {
+      return false;
+    }
+#endif
+    struct stat st;
+    if( fstatat(dirfd, name, &st, flags) != 0 ) {
+      return false;
+    }
+    *mode = st.st_mode;
+    if( id != 0 ) {
+      id->volume = uint64_t(st.st_dev);
+      id->index  = uint64_t(st.st_ino);
+    }
+    return true;
+  }
+
+  // Names are not required to be UTF-8; every invalid byte b is escaped as
+  // the lone surrogate U+DC00+b (U+DC80-U+DCFF), which valid UTF-8 never
+  // yields, so that the name converts back to the same bytes.
+  const wchar_t ESCAPE_BASE = wchar_t(0xDC00);
+
+  inline bool isEscape(const csWStringView& s, const size_t i)
+  {
+    const unsigned int unit = (unsigned int)s[i];
+    if( unit < 0xDC80  ||  unit > 0xDCFF ) {
+      return false;
+    }
+    // NOTE: With 16-bit wchar_t, the low half of a surrogate pair follows
+    //       a high surrogate.
+    const unsigned int prev = i > 0
+        ? (unsigned int)s[i - 1]
+        : 0;
+    return sizeof(wchar_t) > 2  ||  prev < 0xD800  ||  prev > 0xDBFF;
+  }
+
+  bool toUtf8(std::string *utf8, const csWStringView& s)
+  {
+    // NOTE: Every code unit yields at most four bytes.
+    utf8->resize(4*s.size());
+    char *out = &(*utf8)[0];
+
+    size_t read    = 0;
+    size_t written = 0;
+    while( read < s.size() ) {
+      size_t end = read;
+      while( end < s.size()  &&  !isEscape(s, end) ) {
+        end++;
+      }
+
+      const csUtfResult result = csWideToUtf8(s.data() + read, end - read,
+                                              out + written, utf8->size() - written);
+      if( result.error != csUtfNoError ) {
+        return false;
+      }
+      written += result.written;
+
+      if( end < s.size() ) {
+        out[written++] = char(s[end] - ESCAPE_BASE);
+        end++;
+      }
+      read = end;
+    }
+    utf8->resize(written);
+
+    return true;
+  }
+
+  bool statFile(const wchar_t *name, mode_t *mode)
+  {
+    std::string utf8;
+    return name != 0  &&  toUtf8(&utf8, name)  &&
+        statFile(AT_FDCWD, utf8.data(), 0, mode);
+  }
+
+  csFileType fileType(const mode_t mode)
+  {
+    if(        S_ISREG(mode) ) {
+      return csFileTypeFile;
+    } else if( S_ISDIR(mode) ) {
+      return csFileTypeDirectory;
+    } else if( S_ISLNK(mode) ) {
+      return csFileTypeSymLink;
+    }
+    return csFileTypeOther;
+  }
+
+  // NOTE: Enough for NAME_MAX bytes; longer names grow the buffer.
+  const size_t NAME_BUFFER_SIZE = 256;
+
+  // Decodes the NUL terminated name s; invalid bytes are escaped, see toUtf8().
+  csWStringView toWide(std::vector<wchar_t> *buffer, const char *s)
+  {
+    // Fast path: ASCII names are widened while looking for the NUL
+    size_t ascii = 0;
+    {
+      wchar_t *out = buffer->data();
+      const size_t capacity = buffer->size();
+      for(; ascii < capacity; ascii++) {
+        const unsigned char ch = (unsigned char)s[ascii];
+        if( ch == 0 ) {
+          return csWStringView(out, ascii);
+        } else if( ch >= 0x80 ) {
+          break;
+        }
+        out[ascii] = wchar_t(ch);
+      }
+    }
+
+    // NOTE: Every byte yields at most one code unit.
+    const size_t len = ascii + std::strlen(s + ascii);
+    if( buffer->size() < len ) {
+      buffer->resize(len);
+    }
+    wchar_t *out = buffer->data();
+
+    size_t read    = ascii;
+    size_t written = ascii;
+    while( read < len ) {
+      const csUtfResult result = csUtf8ToWide(s + read, len - read,
+                                              out + written, len - written);
+      read    += result.read;
+      written += result.written;
+      if( result.error != csUtfNoError ) {
+        out[written++] = ESCAPE_BASE + wchar_t((unsigned char)s[read]);
+        read++;
+      }
+    }
+
+    return csWStringView(out, written);
+  }
+
+  int openDirectory(const csWStringView& dir)
+  {
+    std::string utf8;
+    if( !toUtf8(&utf8, dir) ) {
+      return -1;
+    }
+    return open(utf8.data(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  }
+
+  // Calls func(name, nativeName, type) for every entry of the directory fd,
+  // which is closed afterwards; returning false stops the listing. Before each batch,
+  // reserve(count, length) receives an estimate of the listing's total number
+  // of entries and length of their names. Returns false on read errors.
+  template<typename ReserveT, typename FuncT>
+  bool readEntries(const int fd, const size_t batchSize, ReserveT reserve, FuncT func)
+  {
+    std::vector<wchar_t> buffer(NAME_BUFFER_SIZE);
+    const auto process = [&](const char *name, const unsigned char d_type) -> bool {
+      const csWStringView wname = toWide(&buffer, name);
+
+      // NOTE: Some file systems do not report the type with the entry.
+      csFileType type = fileType(d_type);
+      mode_t mode;
+      if( type == csFileTypeUnknown  &&  statFile(fd, name, AT_SYMLINK_NOFOLLOW, &mode) ) {
+        type = fileType(mode);
+      }
+
+      return func(wname, name, type);
+    };
+
+#ifdef CS_OS_LINUX
+    // NOTE: On common file systems, the directory's size bounds its records;
+    //       an overestimate only reserves address space, which is never touched.
+    size_t totalCount  = 0;
+    size_t totalLength = 0;
+    struct stat status;
+    if( fstat(fd, &status) == 0  &&  status.st_size > 0  &&
+        size_t(status.st_size) <= MAX_ESTIMATE_SIZE ) {
+      reserve(size_t(status.st_size)/MIN_RECORD_SIZE, size_t(status.st_size));
+    }
+
+    std::unique_ptr<char[]> batch(new char[batchSize]);
+    bool isListing = true;
+    while( isListing ) {
+      const long numBytes = syscall(SYS_getdents64, fd, batch.get(), batchSize);
+      if( numBytes <= 0 ) {
+        close(fd);
+        return numBytes == 0;
+      }
+
+      for(long pos = 0; pos < numBytes; ) {
+        const linux_dirent64 *entry = reinterpret_cast<const linux_dirent64*>(batch.get() + pos);
+        totalCount++;
+        totalLength += entry->d_reclen - offsetof(linux_dirent64, d_name);
+        pos += entry->d_reclen;
+      }
+      reserve(totalCount, totalLength);
+
+      for(long pos = 0; isListing  &&  pos < numBytes; ) {
+        const linux_dirent64 *entry = reinterpret_cast<const linux_dirent64*>(batch.get() + pos);
+        isListing = process(entry->d_name, entry->d_type);
+        pos += entry->d_reclen;
+      }
+    }
+
+    close(fd);
+    return true;
+#else
+    (void)batchSize;
+    (void)reserve;
+
+    DIR *handle = fdopendir(fd);
+    if( handle == 0 ) {
+      close(fd);
+      return false;
+    }
+
+    bool isOk = true;
+    while( true ) {
+      errno = 0;
+      const struct dirent *entry = readdir(handle);
+      if( entry == 0 ) {
+        isOk = errno == 0;
+        break;
+      }
+      if( !process(entry->d_name, entry->d_type) ) {
+        break;
+      }
+    }
+
+    closedir(handle);
+    return isOk;
+#endif
+  }
+
+  // Calls func(name, type) for every entry matching path; returns false if
+  // the directory cannot be read completely. See readEntries() for reserve.
+  template<typename ReserveT, typename FuncT>
+  bool listDirectory(const wchar_t *path, ReserveT reserve, FuncT func)
+  {
+    if( path == 0 ) {
+      return false;
+    }
+
+    const csWStringView pathView(path);
+    const int slash = pathView.lastIndexOf(L'/');
+    const csWStringView last = pathView.mid(slash + 1);
+
+    csGlob<wchar_t> glob;
+    csWStringView dir = pathView;
+    if( last.indexOf(L'*') >= 0  ||  last.indexOf(L'?') >= 0 ) {
+      if( !glob.compile(last) ) {
+        return false;
+      }
+      dir = slash < 0
+          ? csWStringView(L".")
+          : pathView.left(csMax<int>(slash, 1));
+    }
+
+    const int fd = openDirectory(dir);
+    if( fd < 0 ) {
+      return false;
+    }
+
+    return readEntries(fd, BATCH_SIZE, reserve,
+                       [&](const csWStringView& name, const char *, const csFileType type) -> bool {
+      if( !glob.isCompiled()  ||  glob.match(name) ) {
+        func(name, type);
+      }
+      return true;
+    });
+  }
+
+  bool toNative(NativePath *native, const csWStringView& path)
+  {
+    return toUtf8(native, path);
+  }
+
+  bool forEachEntry(const NativePath& dir, const EntryFunc& func)
+  {
+    const int fd = open(dir.data(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if( fd < 0 ) {
+      return false;
+    }
+
+    const auto reserve = [](const size_t, const size_t) -> void {
+    };
+    return readEntries(fd, WALK_BATCH_SIZE, reserve,
+                       [&](const csWStringView& name, const char *nativeName,
+                           const csFileType type) -> bool {
+      if( name == L"."  ||  name == L".." ) {
+        return true;
+      }
+      return func(name, nativeName, type);
+    });
+  }
+
+  bool queryTarget(const NativePath& path, csFileType *type, FileId *id)
+  {
+    mode_t mode;
+    if( !statFile(AT_FDCWD, path.data(), 0, &mode, id) ) {
+      return false;
+    }
+    *type = fileType(mode);
+    return true;
+  }
+
+}; // namespace priv_file
+
+////// Implementation ////////////////////////////////////////////////////////
+
+CS_CORE2_EXPORT bool csFileExists(const wchar_t *name)
+{
+  mode_t mode;
+  return priv_file::statFile(name, &mode);
+}
+
+CS_CORE2_EXPORT bool csIsDirectory(const wchar_t *name)
+{
+  mode_t mode;
+  if( !priv_file::statFile(name, &mode) ) {
+    return false;
+  }
+  return S_ISDIR(mode);
+}
+
+CS_CORE2_EXPORT bool csIsFile(const wchar_t *name)
+{
+  mode_t mode;
+  if( !priv_file::statFile(name, &mode) ) {
+    return false;
+  }
+  return S_ISREG(mode);
+}
+
+CS_CORE2_EXPORT csWStringList csListDirectory(const wchar_t *path)
+{
+  csWStringList files;
+
+  const auto reserve = [](const size_t, const size_t) -> void {
+  };
+  const bool isOk = priv_file::listDirectory(path, reserve,
+                                             [&](const csWStringView& name, const csFileType) -> void {
+    files.emplace_back(name);
+  });
+  if( !isOk ) {
+    files.clear();
+  }
+
+  return files;
+}
+
+CS_CORE2_EXPORT size_t csListDirectory(csWStringTable *files, const wchar_t *path)
+{
+  return csListDirectory(files, 0, path);
+}
+
+CS_CORE2_EXPORT size_t csListDirectory(csWStringTable *files, std::vector<csFileType> *types,
+                                       const wchar_t *path)
+{
+  if( files == 0 ) {
+    return 0;
+  }
+
+  const size_t count    = files->size();
+  const size_t numTypes = types != 0
+      ? types->size()
+      : 0;
+
+  // Geometric growth; reserving each batch exactly would copy repeatedly.
+  const size_t numChars = files->numChars();
+  size_t reservedCount = 0;
+  size_t reservedChars = 0;
+  const auto reserve = [&](const size_t totalCount, const size_t totalLength) -> void {
+    const size_t neededCount = count + totalCount;
+    const size_t neededChars = numChars + totalLength; // including the NULs
+    if( neededCount <= reservedCount  &&  neededChars <= reservedChars ) {
+      return;
+    }
+    reservedCount = csMax(neededCount, 2*reservedCount);
+    reservedChars = csMax(neededChars, 2*reservedChars);
+    files->reserve(reservedCount, reservedChars - reservedCount);
+    if( types != 0 ) {
+      types->reserve(numTypes + reservedCount - count);
+    }
+  };
+
+  const bool isOk = priv_file::listDirectory(path, reserve,
+                                             [&](const csWStringView& name, const csFileType type) -> void {
+    files->append(name);
+    if( types != 0 ) {
+      types->push_back(type);
+    }
+  });
+  if( !isOk ) {
+    files->truncate(count);
+    if( types != 0 ) {
+      types->resize(numTypes);
+    }
+    return 0;
+  }
+
+  return files->size() - count;
+}
@@ -29,9 +29,115 @@
 ** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *****************************************************************************/
 
+#include <string>
+
 #include <Windows.h>
 
 #include "csCore2/csFile.h"
+#include "internal/file.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_file {
+
+  csFileType fileType(const WIN32_FIND_DATAW& data)
+  {
+    const DWORD attr = data.dwFileAttributes;
+    const bool isLink = (attr & FILE_ATTRIBUTE_REPARSE_POINT) != 0  &&
+        (data.dwReserved0 == IO_REPARSE_TAG_SYMLINK  ||
+         data.dwReserved0 == IO_REPARSE_TAG_MOUNT_POINT);
+    if(        isLink ) {
+      return csFileTypeSymLink;
+    } else if( (attr & FILE_ATTRIBUTE_DIRECTORY) != 0 ) {
+      return csFileTypeDirectory;
+    } else if( (attr & FILE_ATTRIBUTE_DEVICE) != 0 ) {
+      return csFileTypeOther;
+    }
+    return csFileTypeFile;
+  }
+
+  // Calls func(name, type) for every entry matching path; returning false
+  // stops the listing. Returns false if nothing matches path or the
+  // listing fails.
+  template<typename FuncT>
+  bool listDirectory(const wchar_t *path, FuncT func)
+  {
+    // NOTE: Skipping the 8.3 names and fetching larger batches speeds up
+    //       listing directories with many entries.
+    WIN32_FIND_DATAW data;
+    const HANDLE handle = FindFirstFileExW(path, FindExInfoBasic, &data,
+                                           FindExSearchNameMatch, 0,
+                                           FIND_FIRST_EX_LARGE_FETCH);
+    if( handle == INVALID_HANDLE_VALUE ) {
+      return false;
+    }
+
+    bool isOk = true;
+    while( func(data.cFileName, fileType(data)) ) {
+      if( FindNextFileW(handle, &data) == 0 ) {
+        isOk = GetLastError() == ERROR_NO_MORE_FILES;
+        break;
+      }
+    }
+
+    FindClose(handle);
+
+    return isOk;
+  }
+
+  bool toNative(NativePath *native, const csWStringView& path)
+  {
+    native->assign(path.data(), path.size());
+    return true;
+  }
+
+  bool forEachEntry(const NativePath& dir, const EntryFunc& func)
+  {
+    std::wstring pattern(dir);
+    pattern += L"\\*";
+
+    return listDirectory(pattern.data(), [&](const wchar_t *name, const csFileType type) -> bool {
+      const csWStringView view(name);
+      if( view == L"."  ||  view == L".." ) {
+        return true;
+      }
+      return func(view, name, type);
+    });
+  }
+
+  bool queryTarget(const NativePath& path, csFileType *type, FileId *id)
+  {
+    const HANDLE handle = CreateFileW(path.data(), FILE_READ_ATTRIBUTES,
+                                      FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                      0, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, 0);
+    if( handle == INVALID_HANDLE_VALUE ) {
+      return false;
+    }
+
+    BY_HANDLE_FILE_INFORMATION info;
+    const bool ok = GetFileInformationByHandle(handle, &info) != 0;
+    CloseHandle(handle);
+    if( !ok ) {
+      return false;
+    }
+
+    if(        (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0 ) {
+      *type = csFileTypeDirectory;
+    } else if( (info.dwFileAttributes & FILE_ATTRIBUTE_DEVICE) != 0 ) {
+      *type = csFileTypeOther;
+    } else {
+      *type = csFileTypeFile;
+    }
+
+    id->volume = info.dwVolumeSerialNumber;
+    id->index  = uint64_t(info.nFileIndexHigh) << 32 | info.nFileIndexLow;
+
+    return true;
+  }
+
+}; // namespace priv_file
+
+////// Implementation ////////////////////////////////////////////////////////
 
 CS_CORE2_EXPORT bool csFileExists(const wchar_t *name)
 {
@@ -63,17 +169,48 @@ CS_CORE2_EXPORT csWStringList csListDirectory(const wchar_t *path)
 {
   csWStringList files;
 
-  WIN32_FIND_DATAW data;
-  HANDLE handle;
-  if( (handle = FindFirstFileW(path, &data)) != INVALID_HANDLE_VALUE ) {
-    files.push_back(data.cFileName);
+  const bool isOk = priv_file::listDirectory(path, [&](const wchar_t *name, const csFileType) -> bool {
+    files.emplace_back(name);
+    return true;
+  });
+  if( !isOk ) {
+    files.clear();
+  }
 
-    while( FindNextFileW(handle, &data) != 0 ) {
-      files.push_back(data.cFileName);
-    }
+  return files;
+}
 
-    FindClose(handle);
+CS_CORE2_EXPORT size_t csListDirectory(csWStringTable *files, const wchar_t *path)
+{
+  return csListDirectory(files, 0, path);
+}
+
+CS_CORE2_EXPORT size_t csListDirectory(csWStringTable *files, std::vector<csFileType> *types,
+                                       const wchar_t *path)
+{
+  if( files == 0 ) {
+    return 0;
   }
 
-  return files;
+  const size_t count    = files->size();
+  const size_t numTypes = types != 0
+      ? types->size()
+      : 0;
+
+  const bool isOk = priv_file::listDirectory(path, [&](const wchar_t *name, const csFileType type) -> bool {
+    files->append(name);
+    if( types != 0 ) {
+      types->push_back(type);
+    }
+    return true;
+  });
+  if( !isOk ) {
+    files->truncate(count);
+    if( types != 0 ) {
+      types->resize(numTypes);
+    }
+    return 0;
+  }
+
+  return files->size() - count;
 }
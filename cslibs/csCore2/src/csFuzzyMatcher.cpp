@@ -0,0 +1,679 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <algorithm>
+
+#include "csCore2/csFuzzyMatcher.h"
+
+#include "internal/cpu.h"
+#include "internal/parallel.h"
+#include "internal/simd_string.h"
+
+#include "csCore2/csChar.h"
+#include "csCore2/csUtil.h"
+
+#ifdef CS_ARCH_X86
+# include <immintrin.h>
+#endif
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_fuzzy {
+
+  ////// Scoring /////////////////////////////////////////////////////////////
+
+  const int SCORE_MATCH        = 16;
+  const int GAP_START          = -3;
+  const int GAP_EXTENSION      = -1;
+
+  const int BONUS_WHITE        = 10; // word following white space
+  const int BONUS_DELIMITER    =  9; // word following a path or list delimiter
+  const int BONUS_BOUNDARY     =  8; // word following other punctuation
+  const int BONUS_NON_WORD     =  8; // matched punctuation
+  const int BONUS_CAMEL        =  7; // "camelCase", "page123"
+  const int BONUS_CONSECUTIVE  = -(GAP_START + GAP_EXTENSION);
+
+  const int FIRST_CHAR_FACTOR  =  2;
+
+  const int NO_SCORE = -(1 << 30);
+
+  // Larger alignments are scored along a single, greedy one
+  const size_t MAX_CELLS = 64*1024;
+
+  // Smaller sets are not worth the threads' start-up
+  const size_t MIN_CHUNK_SIZE = 16*1024;
+
+  // Masks are prefiltered in blocks of this size
+  const size_t FILTER_BLOCK = 256;
+
+  enum CharClass {
+    ClassWhite = 0,
+    ClassDelimiter,
+    ClassOther,
+    ClassLower,
+    ClassUpper,
+    ClassDigit,
+    ClassLetter // any other character; assumed to form words
+  };
+
+  template<typename CharT>
+  inline CharClass classOf(const CharT ch)
+  {
+    if(        CharT('a') <= ch  &&  ch <= CharT('z') ) {
+      return ClassLower;
+    } else if( CharT('A') <= ch  &&  ch <= CharT('Z') ) {
+      return ClassUpper;
+    } else if( CharT('0') <= ch  &&  ch <= CharT('9') ) {
+      return ClassDigit;
+    } else if( ch == CharT(' ')  ||  ch == CharT('\t') ) {
+      return ClassWhite;
+    } else if( ch == CharT('/')  ||  ch == CharT('\\')  ||  ch == CharT(':')  ||
+               ch == CharT(';')  ||  ch == CharT(',')   ||  ch == CharT('|') ) {
+      return ClassDelimiter;
+    }
+
+    typedef typename std::make_unsigned<CharT>::type UnitT;
+    return UnitT(ch) < 0x80
+        ? ClassOther
+        : ClassLetter;
+  }
+
+  inline bool isWord(const CharClass cls)
+  {
+    return cls >= ClassLower;
+  }
+
+  inline int bonusOf(const CharClass prev, const CharClass cur)
+  {
+    if( !isWord(cur) ) {
+      return BONUS_NON_WORD;
+    }
+
+    if(        prev == ClassWhite ) {
+      return BONUS_WHITE;
+    } else if( prev == ClassDelimiter ) {
+      return BONUS_DELIMITER;
+    } else if( prev == ClassOther ) {
+      return BONUS_BOUNDARY;
+    } else if( (prev == ClassLower  &&  cur == ClassUpper)  ||
+               (prev != ClassDigit  &&  cur == ClassDigit) ) {
+      return BONUS_CAMEL;
+    }
+
+    return 0;
+  }
+
+  inline int gapPenalty(const size_t gap)
+  {
+    return GAP_START + GAP_EXTENSION*int(gap - 1);
+  }
+
+  ////// Character masks /////////////////////////////////////////////////////
+
+  // Bit of ch mapped by csToLower(): letters and digits have a bit each,
+  // other ASCII characters share bits 36 to 62, and all other characters
+  // bit 63.
+  template<typename CharT>
+  inline uint64_t maskBit(const CharT ch)
+  {
+    typedef typename std::make_unsigned<CharT>::type UnitT;
+    const UnitT u = UnitT(csToLower(ch));
+    if(        UnitT('a') <= u  &&  u <= UnitT('z') ) {
+      return uint64_t(1) << (u - UnitT('a'));
+    } else if( UnitT('0') <= u  &&  u <= UnitT('9') ) {
+      return uint64_t(1) << (26 + u - UnitT('0'));
+    } else if( u < 0x80 ) {
+      return uint64_t(1) << (36 + u % 27);
+    }
+    return uint64_t(1) << 63;
+  }
+
+  template<typename CharT>
+  inline uint64_t maskOf(const CharT *s, const size_t len)
+  {
+    uint64_t mask = 0;
+    for(size_t i = 0; i < len; i++) {
+      mask |= maskBit(s[i]);
+    }
+    return mask;
+  }
+
+  // Writes the indices i of masks[0,count) where all of required's bits are
+  // set to hits; returns the number of indices written.
+  size_t filterMasks_scalar(const uint64_t *masks, const size_t count,
+                            const uint64_t required, uint32_t *hits)
+  {
+    size_t numHits = 0;
+    for(size_t i = 0; i < count; i++) {
+      hits[numHits] = uint32_t(i);
+      numHits += size_t((masks[i] & required) == required);
+    }
+    return numHits;
+  }
+
+#ifdef CS_ARCH_X86
+
+  CS_TARGET_SSE2 size_t filterMasks_sse2(const uint64_t *masks, const size_t count,
+                                         const uint64_t required, uint32_t *hits)
+  {
+    const __m128i req = _mm_set1_epi64x(int64_t(required));
+
+    size_t numHits = 0;
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+      const __m128i m0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks + i));
+      const __m128i m1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks + i + 2));
+      // NOTE: SSE2 lacks 64-bit comparison; both 32-bit halves must match.
+      const int eq0 = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(m0, req), req));
+      const int eq1 = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(m1, req), req));
+      if( (eq0 | eq1) == 0 ) {
+        continue;
+      }
+      const int eq = eq0 | (eq1 << 16);
+      for(int j = 0; j < 4; j++) {
+        hits[numHits] = uint32_t(i + j);
+        numHits += size_t(((eq >> 8*j) & 0xFF) == 0xFF);
+      }
+    }
+
+    for(; i < count; i++) {
+      hits[numHits] = uint32_t(i);
+      numHits += size_t((masks[i] & required) == required);
+    }
+
+    return numHits;
+  }
+
+  CS_TARGET_AVX2 size_t filterMasks_avx2(const uint64_t *masks, const size_t count,
+                                         const uint64_t required, uint32_t *hits)
+  {
+    const __m256i req = _mm256_set1_epi64x(int64_t(required));
+
+    size_t numHits = 0;
+    size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+      const __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks + i));
+      int eq = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(m, req), req)));
+      while( eq != 0 ) {
+        hits[numHits++] = uint32_t(i + size_t(priv_cpu::ctz32(uint32_t(eq))));
+        eq &= eq - 1;
+      }
+    }
+
+    for(; i < count; i++) {
+      hits[numHits] = uint32_t(i);
+      numHits += size_t((masks[i] & required) == required);
+    }
+
+    return numHits;
+  }
+
+#endif // CS_ARCH_X86
+
+  ////// Dispatch ////////////////////////////////////////////////////////////
+
+  struct Kernels {
+    using filterMasks_func = size_t (*)(const uint64_t*, const size_t, const uint64_t, uint32_t*);
+
+    Kernels()
+      : filterMasks(filterMasks_scalar)
+    {
+#ifdef CS_ARCH_X86
+      const priv_cpu::Level level = priv_cpu::level();
+      if(        level >= priv_cpu::AVX2 ) {
+        filterMasks = filterMasks_avx2;
+      } else if( level >= priv_cpu::SSE2 ) {
+        filterMasks = filterMasks_sse2;
+      }
+#endif
+    }
+
+    static const Kernels& get()
+    {
+      static const Kernels kernels;
+      return kernels;
+    }
+
+    filterMasks_func filterMasks;
+  };
+
+  ////// Alignment ///////////////////////////////////////////////////////////
+
+  // Buffers reused while scoring several texts
+  struct Scratch {
+    std::vector<size_t> first;  // leftmost position of each pattern character
+    std::vector<size_t> last;   // rightmost position of each pattern character
+    std::vector<int>    cells;  // score of each pattern character at each column
+  };
+
+  template<typename CharT>
+  inline bool isEqual(const CharT textCh, const CharT patternCh, const bool ignoreCase)
+  {
+    return ignoreCase
+        ? csToLower(textCh) == patternCh
+        : textCh == patternCh;
+  }
+
+  // Leftmost position of ch in text[from,len); SIZE_MAX if not found
+  template<typename CharT>
+  inline size_t findNext(const CharT *text, const size_t len, const size_t from,
+                         const CharT ch, const bool ignoreCase)
+  {
+    const CharT set[2] = { ch, csToUpper(ch) };
+    const size_t setLen = ignoreCase  &&  set[1] != ch
+        ? 2
+        : 1;
+    const size_t i = priv_simd::stringFindFirstOf(text + from, len - from, set, setLen);
+    return i != SIZE_MAX
+        ? from + i
+        : SIZE_MAX;
+  }
+
+  template<typename CharT>
+  inline int bonusAt(const CharT *text, const size_t j)
+  {
+    return bonusOf(j > 0 ? classOf(text[j - 1]) : ClassWhite, classOf(text[j]));
+  }
+
+  // Score of the alignment given by positions
+  template<typename CharT>
+  int scorePath(const CharT *text, const size_t *positions, const size_t count)
+  {
+    int score = 0;
+    for(size_t i = 0; i < count; i++) {
+      const size_t j = positions[i];
+      const int bonus = bonusAt(text, j);
+      if(        i == 0 ) {
+        score += SCORE_MATCH + FIRST_CHAR_FACTOR*bonus;
+      } else if( positions[i - 1] + 1 == j ) {
+        score += SCORE_MATCH + csMax(bonus, BONUS_CONSECUTIVE);
+      } else {
+        score += SCORE_MATCH + gapPenalty(j - positions[i - 1] - 1) + bonus;
+      }
+    }
+    return score;
+  }
+
+  // Returns < 0 if pattern is no subsequence of text
+  template<typename CharT>
+  int align(const CharT *pattern, const size_t patternLen,
+            const CharT *text, const size_t len, const bool ignoreCase,
+            Scratch *scratch, std::vector<size_t> *positions)
+  {
+    if( positions != 0 ) {
+      positions->clear();
+    }
+
+    if( patternLen < 1 ) {
+      return 0;
+    }
+
+    // (1) Leftmost and rightmost alignments bound each character's positions
+
+    std::vector<size_t>& first = scratch->first;
+    std::vector<size_t>& last  = scratch->last;
+    first.resize(patternLen);
+    last.resize(patternLen);
+
+    size_t from = 0;
+    for(size_t i = 0; i < patternLen; i++) {
+      if( from >= len ) {
+        return -1;
+      }
+      first[i] = findNext(text, len, from, pattern[i], ignoreCase);
+      if( first[i] == SIZE_MAX ) {
+        return -1;
+      }
+      from = first[i] + 1;
+    }
+
+    size_t to = len;
+    for(size_t i = patternLen; i-- > 0; ) {
+      size_t j = to - 1;
+      while( !isEqual(text[j], pattern[i], ignoreCase) ) {
+        j--;
+      }
+      last[i] = j;
+      to = j;
+    }
+
+    const size_t begin = first[0];
+    const size_t width = last[patternLen - 1] - begin + 1;
+
+    // (2) Large alignments: tightest window ending at the leftmost end
+
+    if( patternLen*width > MAX_CELLS ) {
+      std::vector<size_t> path(patternLen);
+      size_t j = first[patternLen - 1];
+      path[patternLen - 1] = j;
+      for(size_t i = patternLen - 1; i-- > 0; ) {
+        do {
+          j--;
+        } while( !isEqual(text[j], pattern[i], ignoreCase) );
+        path[i] = j;
+      }
+
+      const int score = csMax(scorePath(text, path.data(), patternLen), 0);
+      if( positions != 0 ) {
+        positions->swap(path);
+      }
+      return score;
+    }
+
+    // (3) Best alignment; cells[i*width + j - begin] is the best score of
+    //     pattern[0,i] with pattern[i] matched at text[j].
+
+    std::vector<int>& cells = scratch->cells;
+    cells.assign(patternLen*width, NO_SCORE);
+
+    for(size_t j = first[0]; j <= last[0]; j++) {
+      if( isEqual(text[j], pattern[0], ignoreCase) ) {
+        cells[j - begin] = SCORE_MATCH + FIRST_CHAR_FACTOR*bonusAt(text, j);
+      }
+    }
+
+    for(size_t i = 1; i < patternLen; i++) {
+      const int *prev = cells.data() + (i - 1)*width;
+      int       *cur  = cells.data() + i*width;
+
+      int carry = NO_SCORE; // best of prev[k] + gapPenalty(j - k - 1), k < j - 1
+      for(size_t j = first[i - 1] + 1; j <= last[i]; j++) {
+        const int diagonal = prev[j - 1 - begin];
+
+        if( j >= first[i]  &&  isEqual(text[j], pattern[i], ignoreCase) ) {
+          const int b = bonusAt(text, j);
+          int best = NO_SCORE;
+          if( diagonal != NO_SCORE ) {
+            best = diagonal + csMax(b, BONUS_CONSECUTIVE);
+          }
+          if( carry != NO_SCORE ) {
+            best = csMax(best, carry + b);
+          }
+          if( best != NO_SCORE ) {
+            cur[j - begin] = SCORE_MATCH + best;
+          }
+        }
+
+        if( carry != NO_SCORE ) {
+          carry += GAP_EXTENSION;
+        }
+        if( diagonal != NO_SCORE ) {
+          carry = csMax(carry, diagonal + GAP_START);
+        }
+      }
+    }
+
+    const int *lastRow = cells.data() + (patternLen - 1)*width;
+    size_t end = first[patternLen - 1];
+    for(size_t j = end + 1; j <= last[patternLen - 1]; j++) {
+      if( lastRow[j - begin] > lastRow[end - begin] ) {
+        end = j;
+      }
+    }
+
+    // NOTE: Long gaps may yield negative scores, which indicate no match.
+    const int score = csMax(lastRow[end - begin], 0);
+    if( positions == 0 ) {
+      return score;
+    }
+
+    // (4) Trace the best alignment back
+
+    positions->resize(patternLen);
+    size_t j = end;
+    (*positions)[patternLen - 1] = j;
+    for(size_t i = patternLen - 1; i > 0; i--) {
+      const int *prev = cells.data() + (i - 1)*width;
+      const int  b    = bonusAt(text, j);
+      const int  from = cells[i*width + j - begin] - SCORE_MATCH;
+
+      const int diagonal = prev[j - 1 - begin];
+      if( diagonal != NO_SCORE  &&  diagonal + csMax(b, BONUS_CONSECUTIVE) == from ) {
+        j = j - 1;
+      } else {
+        size_t k = j - 1;
+        do {
+          k--;
+        } while( prev[k - begin] == NO_SCORE  ||
+                 prev[k - begin] + gapPenalty(j - k - 1) + b != from );
+        j = k;
+      }
+
+      (*positions)[i - 1] = j;
+    }
+
+    return score;
+  }
+
+  ////// Selection ///////////////////////////////////////////////////////////
+
+  inline bool isBetter(const csFuzzyMatch& a, const csFuzzyMatch& b)
+  {
+    return a.score > b.score  ||  (a.score == b.score  &&  a.index < b.index);
+  }
+
+  // Keeps the best maxCount matches; the worst is at the heap's front
+  inline void keepBest(std::vector<csFuzzyMatch> *heap, const size_t maxCount,
+                       const csFuzzyMatch& match)
+  {
+    if( heap->size() < maxCount ) {
+      heap->push_back(match);
+      std::push_heap(heap->begin(), heap->end(), isBetter);
+    } else if( isBetter(match, heap->front()) ) {
+      std::pop_heap(heap->begin(), heap->end(), isBetter);
+      heap->back() = match;
+      std::push_heap(heap->begin(), heap->end(), isBetter);
+    }
+  }
+
+}; // namespace priv_fuzzy
+
+////// Implementation - csFuzzyCandidates ////////////////////////////////////
+
+template<typename CharT>
+csFuzzyCandidates<CharT>::csFuzzyCandidates()
+  : _strings()
+  , _masks()
+{
+}
+
+template<typename CharT>
+csFuzzyCandidates<CharT>::~csFuzzyCandidates()
+{
+}
+
+template<typename CharT>
+void csFuzzyCandidates<CharT>::append(const csBasicStringView<CharT>& s)
+{
+  _strings.append(s);
+  _masks.push_back(priv_fuzzy::maskOf(s.data(), s.size()));
+}
+
+template<typename CharT>
+void csFuzzyCandidates<CharT>::clear()
+{
+  _strings.clear();
+  _masks.clear();
+}
+
+template<typename CharT>
+void csFuzzyCandidates<CharT>::reserve(const size_t count, const size_t length)
+{
+  _strings.reserve(count, length);
+  _masks.reserve(count);
+}
+
+////// Implementation - csFuzzyMatcher ///////////////////////////////////////
+
+template<typename CharT>
+csFuzzyMatcher<CharT>::csFuzzyMatcher()
+  : _pattern()
+  , _original()
+  , _ignoreCase(true)
+  , _mask(0)
+{
+}
+
+template<typename CharT>
+csFuzzyMatcher<CharT>::csFuzzyMatcher(const csBasicStringView<CharT>& pattern,
+                                      const bool ignoreCase)
+  : _pattern()
+  , _original()
+  , _ignoreCase(true)
+  , _mask(0)
+{
+  setPattern(pattern, ignoreCase);
+}
+
+template<typename CharT>
+csFuzzyMatcher<CharT>::~csFuzzyMatcher()
+{
+}
+
+template<typename CharT>
+void csFuzzyMatcher<CharT>::setPattern(const csBasicStringView<CharT>& pattern,
+                                       const bool ignoreCase)
+{
+  _original.assign(pattern.data(), pattern.size());
+  _pattern = _original;
+  if( ignoreCase  &&  !_pattern.empty() ) {
+    csToLower(&_pattern[0], _pattern.size());
+  }
+  _ignoreCase = ignoreCase;
+  _mask = priv_fuzzy::maskOf(_pattern.data(), _pattern.size());
+}
+
+template<typename CharT>
+bool csFuzzyMatcher<CharT>::ignoreCase() const
+{
+  return _ignoreCase;
+}
+
+template<typename CharT>
+const std::basic_string<CharT>& csFuzzyMatcher<CharT>::pattern() const
+{
+  return _original;
+}
+
+template<typename CharT>
+bool csFuzzyMatcher<CharT>::isMatch(const csBasicStringView<CharT>& text) const
+{
+  size_t from = 0;
+  for(const CharT ch : _pattern) {
+    if( from >= text.size() ) {
+      return false;
+    }
+    const size_t i = priv_fuzzy::findNext(text.data(), text.size(), from, ch, _ignoreCase);
+    if( i == SIZE_MAX ) {
+      return false;
+    }
+    from = i + 1;
+  }
+  return true;
+}
+
+template<typename CharT>
+int csFuzzyMatcher<CharT>::score(const csBasicStringView<CharT>& text,
+                                 std::vector<size_t> *positions) const
+{
+  priv_fuzzy::Scratch scratch;
+  return priv_fuzzy::align(_pattern.data(), _pattern.size(), text.data(), text.size(),
+                           _ignoreCase, &scratch, positions);
+}
+
+template<typename CharT>
+std::vector<csFuzzyMatch> csFuzzyMatcher<CharT>::findBest(const csFuzzyCandidates<CharT>& candidates,
+                                                          const size_t maxCount,
+                                                          const int threadCount) const
+{
+  using namespace priv_fuzzy;
+
+  const size_t numCandidates = candidates.size();
+  if( numCandidates < 1  ||  maxCount < 1 ) {
+    return std::vector<csFuzzyMatch>();
+  }
+
+  const Kernels::filterMasks_func filterMasks = Kernels::get().filterMasks;
+
+  const size_t numChunks = csBound<size_t>(1, numCandidates/MIN_CHUNK_SIZE,
+                                           priv_parallel::threadCount(threadCount));
+
+  std::vector<std::vector<csFuzzyMatch>> heaps(numChunks);
+
+  priv_parallel::run(numChunks, [&](const size_t chunk) -> void {
+    const size_t begin = numCandidates*chunk/numChunks;
+    const size_t end   = numCandidates*(chunk + 1)/numChunks;
+
+    std::vector<csFuzzyMatch>& heap = heaps[chunk];
+    heap.reserve(maxCount + 1);
+
+    Scratch scratch;
+    uint32_t hits[FILTER_BLOCK];
+
+    for(size_t block = begin; block < end; block += FILTER_BLOCK) {
+      const size_t count = std::min(FILTER_BLOCK, end - block);
+      const size_t numHits = filterMasks(candidates.masks() + block, count, _mask, hits);
+
+      for(size_t h = 0; h < numHits; h++) {
+        const size_t index = block + hits[h];
+        const csBasicStringView<CharT> text = candidates[index];
+
+        const int score = align(_pattern.data(), _pattern.size(), text.data(), text.size(),
+                                _ignoreCase, &scratch, 0);
+        if( score >= 0 ) {
+          keepBest(&heap, maxCount, csFuzzyMatch{index, score});
+        }
+      }
+    }
+  });
+
+  std::vector<csFuzzyMatch> result;
+  for(const std::vector<csFuzzyMatch>& heap : heaps) {
+    for(const csFuzzyMatch& match : heap) {
+      keepBest(&result, maxCount, match);
+    }
+  }
+  std::sort(result.begin(), result.end(), isBetter);
+
+  return result;
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csFuzzyCandidates<char>;
+template class CS_CORE2_EXPORT_INSTANTIATION csFuzzyMatcher<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csFuzzyCandidates<wchar_t>;
+template class CS_CORE2_EXPORT_INSTANTIATION csFuzzyMatcher<wchar_t>;
+#endif
@@ -0,0 +1,582 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <algorithm>
+#include <type_traits>
+
+#include "csCore2/csGlob.h"
+
+#include "internal/simd_string.h"
+
+#include "csCore2/csChar.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_glob {
+
+  // The automaton's state is one bit per token plus the accepting bit;
+  // up to MAX_TOKENS, it fits into one word.
+  const size_t MAX_TOKENS = 63;
+
+  // Wider states live on the stack up to this many words
+  const size_t MAX_STACK_WORDS = 16;
+
+  // Rows of the automaton's masks: the tokens consuming each ASCII character,
+  // the tokens looping on non-separators (stars) and on any character.
+  const size_t STAR_ROW     = 128;
+  const size_t GLOBSTAR_ROW = 129;
+  const size_t NUM_ROWS     = 130;
+
+  template<typename CharT>
+  inline bool isSeparator(const CharT ch)
+  {
+    return ch == CharT('/')  ||  ch == CharT('\\');
+  }
+
+  template<typename CharT>
+  inline bool isAscii(const CharT ch)
+  {
+    typedef typename std::make_unsigned<CharT>::type UnitT;
+    return UnitT(ch) < 0x80;
+  }
+
+  // NOTE: File names are short; below this length, plain loops beat the
+  //       dispatch to the vectorized kernels.
+  const size_t SHORT_TEXT = 64;
+
+  // 'pattern' is mapped by csToLower() if ignoring case
+  template<typename CharT>
+  inline bool isEqual(const CharT *text, const CharT *pattern, const size_t len,
+                      const bool ignoreCase)
+  {
+    for(size_t i = 0; i < len; i++) {
+      const CharT ch = ignoreCase
+          ? csToLower(text[i])
+          : text[i];
+      if( ch != pattern[i] ) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template<bool IGNORE_CASE, typename CharT>
+  inline size_t findShort(const CharT *text, const size_t len,
+                          const CharT *pattern, const size_t patternLen)
+  {
+    const CharT first = pattern[0];
+    for(size_t i = 0; i + patternLen <= len; i++) {
+      const CharT ch = IGNORE_CASE
+          ? csToLower(text[i])
+          : text[i];
+      if( ch == first  &&  isEqual(text + i + 1, pattern + 1, patternLen - 1, IGNORE_CASE) ) {
+        return i;
+      }
+    }
+    return SIZE_MAX;
+  }
+
+  template<typename CharT>
+  inline size_t find(const CharT *text, const size_t len,
+                     const CharT *pattern, const size_t patternLen, const bool ignoreCase)
+  {
+    if( len >= SHORT_TEXT ) {
+      return priv_simd::stringFind(text, len, pattern, patternLen, ignoreCase);
+    }
+    return ignoreCase
+        ? findShort<true>(text, len, pattern, patternLen)
+        : findShort<false>(text, len, pattern, patternLen);
+  }
+
+  template<typename CharT>
+  inline bool hasSeparator(const CharT *s, const size_t len)
+  {
+    if( len >= SHORT_TEXT ) {
+      const CharT SEPARATORS[2] = { CharT('/'), CharT('\\') };
+      return priv_simd::stringFindFirstOf(s, len, SEPARATORS, 2) != SIZE_MAX;
+    }
+    for(size_t i = 0; i < len; i++) {
+      if( isSeparator(s[i]) ) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+}; // namespace priv_glob
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csGlob<CharT>::csGlob()
+{
+  clear();
+}
+
+template<typename CharT>
+csGlob<CharT>::~csGlob()
+{
+}
+
+template<typename CharT>
+void csGlob<CharT>::clear()
+{
+  _pattern.clear();
+  _ignoreCase = false;
+  _isCompiled = false;
+
+  _prefix.clear();
+  _suffix.clear();
+  _minMiddle = 0;
+
+  _middle = MiddleEmpty;
+  _literals.clear();
+  _segments.clear();
+  _crossesSeparators = false;
+  _tokens.clear();
+  _ranges.clear();
+  _numWords = 0;
+  _masks.clear();
+}
+
+template<typename CharT>
+bool csGlob<CharT>::compile(const csBasicStringView<CharT>& pattern, const bool ignoreCase)
+{
+  clear();
+
+  _pattern.assign(pattern.data(), pattern.size());
+  _ignoreCase = ignoreCase;
+
+  // (1) Tokenize
+
+  std::vector<Token> tokens;
+  const size_t len = pattern.size();
+  for(size_t i = 0; i < len; ) {
+    Token token{Token::Literal, pattern[i], 0, 0, false};
+
+    if(        pattern[i] == CharT('*') ) {
+      token.type = Token::Star;
+      for(i++; i < len  &&  pattern[i] == CharT('*'); i++) {
+        token.type = Token::GlobStar;
+      }
+
+    } else if( pattern[i] == CharT('?') ) {
+      token.type = Token::Any;
+      i++;
+
+    } else if( pattern[i] == CharT('[') ) {
+      size_t j = i + 1;
+      const bool negate = j < len  &&  (pattern[j] == CharT('!')  ||  pattern[j] == CharT('^'));
+      if( negate ) {
+        j++;
+      }
+      const size_t first = j;
+      if( j < len  &&  pattern[j] == CharT(']') ) {
+        j++;
+      }
+      while( j < len  &&  pattern[j] != CharT(']') ) {
+        j++;
+      }
+
+      if( j >= len ) { // Unterminated; '[' is a literal
+        i++;
+      } else {
+        token.type       = Token::Set;
+        token.rangeBegin = _ranges.size();
+        token.negate     = negate;
+        for(size_t k = first; k < j; ) {
+          if( k + 2 < j  &&  pattern[k + 1] == CharT('-') ) {
+            _ranges.push_back(pattern[k]);
+            _ranges.push_back(pattern[k + 2]);
+            k += 3;
+          } else {
+            _ranges.push_back(pattern[k]);
+            _ranges.push_back(pattern[k]);
+            k += 1;
+          }
+        }
+        token.rangeEnd = _ranges.size();
+        i = j + 1;
+      }
+
+    } else {
+      i++;
+    }
+
+    tokens.push_back(token);
+  }
+
+  // (2) Literal prefix & suffix
+
+  size_t first = 0;
+  while( first < tokens.size()  &&  tokens[first].type == Token::Literal ) {
+    _prefix.push_back(tokens[first].ch);
+    first++;
+  }
+
+  if( first >= tokens.size() ) {
+    if( _ignoreCase ) {
+      csToLower(&_prefix[0], _prefix.size());
+    }
+    _isCompiled = true;
+    return true;
+  }
+
+  size_t last = tokens.size();
+  while( tokens[last - 1].type == Token::Literal ) {
+    last--;
+  }
+  for(size_t i = last; i < tokens.size(); i++) {
+    _suffix.push_back(tokens[i].ch);
+  }
+
+  if( _ignoreCase ) {
+    csToLower(&_prefix[0], _prefix.size());
+    csToLower(&_suffix[0], _suffix.size());
+  }
+
+  // (3) Middle part
+
+  _tokens.assign(tokens.begin() + first, tokens.begin() + last);
+
+  for(const Token& token : _tokens) {
+    if( token.type < Token::Star ) {
+      _minMiddle++;
+    }
+  }
+
+  // NOTE: Leftmost matching of the literals is exact if either no star may
+  //       cross a separator and none is matched literally, or all stars may.
+  bool isSegments = _tokens.front().type >= Token::Star  &&  _tokens.back().type >= Token::Star;
+  size_t numStars = 0;
+  size_t numGlobStars = 0;
+  for(const Token& token : _tokens) {
+    if(        token.type == Token::Literal ) {
+      isSegments = isSegments  &&  !priv_glob::isSeparator(token.ch);
+    } else if( token.type == Token::Star ) {
+      numStars++;
+    } else if( token.type == Token::GlobStar ) {
+      numGlobStars++;
+    } else {
+      isSegments = false;
+    }
+  }
+
+  if( isSegments  &&  (numStars == 0  ||  numGlobStars == 0) ) {
+    _middle = MiddleSegments;
+    _crossesSeparators = numStars == 0;
+
+    bool afterStar = false;
+    for(const Token& token : _tokens) {
+      if( token.type >= Token::Star ) {
+        afterStar = true;
+        continue;
+      }
+      if( afterStar ) {
+        _segments.push_back(Segment{_literals.size(), 0});
+        afterStar = false;
+      }
+      _literals.push_back(token.ch);
+      _segments.back().size++;
+    }
+
+    if( _ignoreCase ) {
+      csToLower(&_literals[0], _literals.size());
+    }
+
+    _isCompiled = true;
+    return true;
+  }
+
+  _middle = _tokens.size() <= priv_glob::MAX_TOKENS
+      ? MiddleAutomaton
+      : MiddleWideAutomaton;
+
+  _numWords = _tokens.size()/64 + 1;
+  _masks.assign(priv_glob::NUM_ROWS*_numWords, 0);
+
+  for(size_t i = 0; i < _tokens.size(); i++) {
+    const Token& token = _tokens[i];
+    const auto setBit = [&](const size_t row) -> void {
+      _masks[row*_numWords + i/64] |= uint64_t(1) << (i % 64);
+    };
+
+    if(        token.type == Token::Star ) {
+      setBit(priv_glob::STAR_ROW);
+    } else if( token.type == Token::GlobStar ) {
+      setBit(priv_glob::GLOBSTAR_ROW);
+    } else if( token.type == Token::Literal ) {
+      if( priv_glob::isAscii(token.ch) ) {
+        setBit(size_t(token.ch));
+        if( _ignoreCase ) {
+          setBit(size_t(csToLower(token.ch)));
+          setBit(size_t(csToUpper(token.ch)));
+        }
+      }
+    } else {
+      for(size_t c = 0; c < 128; c++) {
+        if( (token.type == Token::Any  &&  !priv_glob::isSeparator(CharT(c)))  ||
+            (token.type == Token::Set  &&  isSetMember(token, CharT(c))) ) {
+          setBit(c);
+        }
+      }
+    }
+  }
+
+  _isCompiled = true;
+
+  return true;
+}
+
+template<typename CharT>
+bool csGlob<CharT>::ignoreCase() const
+{
+  return _ignoreCase;
+}
+
+template<typename CharT>
+bool csGlob<CharT>::isCompiled() const
+{
+  return _isCompiled;
+}
+
+template<typename CharT>
+const std::basic_string<CharT>& csGlob<CharT>::pattern() const
+{
+  return _pattern;
+}
+
+template<typename CharT>
+bool csGlob<CharT>::match(const csBasicStringView<CharT>& text) const
+{
+  if( !_isCompiled ) {
+    return false;
+  }
+
+  const size_t len = text.size();
+  if( len < _prefix.size() + _suffix.size() + _minMiddle ) {
+    return false;
+  }
+
+  if( !priv_glob::isEqual(text.data(), _prefix.data(), _prefix.size(), _ignoreCase)  ||
+      !priv_glob::isEqual(text.data() + len - _suffix.size(), _suffix.data(), _suffix.size(), _ignoreCase) ) {
+    return false;
+  }
+
+  const CharT *middle    = text.data() + _prefix.size();
+  const size_t middleLen = len - _prefix.size() - _suffix.size();
+
+  if(        _middle == MiddleEmpty ) {
+    return middleLen == 0;
+  } else if( _middle == MiddleSegments ) {
+    return matchSegments(middle, middleLen);
+  } else if( _middle == MiddleWideAutomaton ) {
+    return matchWideAutomaton(middle, middleLen);
+  }
+
+  return matchAutomaton(middle, middleLen);
+}
+
+////// private ///////////////////////////////////////////////////////////////
+
+template<typename CharT>
+bool csGlob<CharT>::isSetMember(const Token& token, const CharT ch) const
+{
+  if( priv_glob::isSeparator(ch) ) {
+    return false;
+  }
+
+  const auto isInRange = [&](const CharT c) -> bool {
+    for(size_t i = token.rangeBegin; i < token.rangeEnd; i += 2) {
+      if( _ranges[i] <= c  &&  c <= _ranges[i + 1] ) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  const bool isMember = _ignoreCase
+      ? isInRange(ch)  ||  isInRange(csToLower(ch))  ||  isInRange(csToUpper(ch))
+      : isInRange(ch);
+
+  return isMember != token.negate;
+}
+
+// Bit-parallel simulation of the tokens' automaton: bit i of the state is
+// set while the text read so far matches the tokens before token i.
+template<typename CharT>
+bool csGlob<CharT>::matchAutomaton(const CharT *text, const size_t len) const
+{
+  const uint64_t *asciiMask   = _masks.data();
+  const uint64_t globStarMask = _masks[priv_glob::GLOBSTAR_ROW];
+  const uint64_t loopMask     = _masks[priv_glob::STAR_ROW] | globStarMask;
+  const uint64_t acceptBit    = uint64_t(1) << _tokens.size();
+
+  // Stars also match nothing; as adjacent stars are collapsed into one
+  // token, a single step suffices.
+  const auto closure = [=](const uint64_t state) -> uint64_t {
+    return state | ((state & loopMask) << 1);
+  };
+
+  uint64_t state = closure(1);
+  for(size_t i = 0; i < len; i++) {
+    const CharT ch = text[i];
+
+    uint64_t consume;
+    if( priv_glob::isAscii(ch) ) {
+      consume = asciiMask[size_t(ch)];
+    } else {
+      transitionMask(ch, &consume);
+    }
+    const uint64_t loop = priv_glob::isSeparator(ch)
+        ? globStarMask
+        : loopMask;
+
+    state = closure(((state & consume) << 1) | (state & loop));
+    if( state == 0 ) {
+      return false;
+    }
+  }
+
+  return (state & acceptBit) != 0;
+}
+
+// Leftmost match of each segment; a later match never leaves more text for
+// the following segments.
+// NOTE: The literals hold no separator, so stars not crossing separators
+//       require none in the whole text; checking this last spares the
+//       extra pass over the (many) texts rejected by the literals.
+template<typename CharT>
+bool csGlob<CharT>::matchSegments(const CharT *text, const size_t len) const
+{
+  size_t pos = 0;
+  for(const Segment& segment : _segments) {
+    const size_t hit = priv_glob::find(text + pos, len - pos,
+                                       _literals.data() + segment.begin, segment.size,
+                                       _ignoreCase);
+    if( hit == SIZE_MAX ) {
+      return false;
+    }
+    pos += hit + segment.size;
+  }
+
+  return _crossesSeparators  ||  !priv_glob::hasSeparator(text, len);
+}
+
+// matchAutomaton() on a state of _numWords words; the shifts carry the top
+// bit of each word into the next one.
+template<typename CharT>
+bool csGlob<CharT>::matchWideAutomaton(const CharT *text, const size_t len) const
+{
+  const size_t    numWords     = _numWords;
+  const uint64_t *starMask     = _masks.data() + priv_glob::STAR_ROW*numWords;
+  const uint64_t *globStarMask = _masks.data() + priv_glob::GLOBSTAR_ROW*numWords;
+
+  uint64_t buffer[2*priv_glob::MAX_STACK_WORDS];
+  std::vector<uint64_t> heap;
+  uint64_t *state = buffer;
+  if( numWords > priv_glob::MAX_STACK_WORDS ) {
+    heap.resize(2*numWords);
+    state = heap.data();
+  }
+  uint64_t *consumeNonAscii = state + numWords;
+
+  // Same step as matchAutomaton(): closure(((state & consume) << 1) | (state & loop))
+  const auto step = [&](const uint64_t *consume, const bool isSeparator) -> uint64_t {
+    uint64_t carryConsume = 0;
+    uint64_t carryClosure = 0;
+    uint64_t any = 0;
+    for(size_t w = 0; w < numWords; w++) {
+      const uint64_t loopMask = starMask[w] | globStarMask[w];
+      const uint64_t loop     = isSeparator
+          ? globStarMask[w]
+          : loopMask;
+
+      const uint64_t consumed = state[w] & consume[w];
+      const uint64_t next = (consumed << 1) | carryConsume | (state[w] & loop);
+      carryConsume = consumed >> 63;
+
+      state[w] = next | ((next & loopMask) << 1) | carryClosure;
+      carryClosure = (next & loopMask) >> 63;
+
+      any |= state[w];
+    }
+    return any;
+  };
+
+  // closure(1)
+  std::fill(state, state + numWords, uint64_t(0));
+  state[0] = uint64_t(1) | (((starMask[0] | globStarMask[0]) & 1) << 1);
+
+  for(size_t i = 0; i < len; i++) {
+    const CharT ch = text[i];
+
+    const uint64_t *consume;
+    if( priv_glob::isAscii(ch) ) {
+      consume = _masks.data() + size_t(ch)*numWords;
+    } else {
+      transitionMask(ch, consumeNonAscii);
+      consume = consumeNonAscii;
+    }
+
+    if( step(consume, priv_glob::isSeparator(ch)) == 0 ) {
+      return false;
+    }
+  }
+
+  const size_t accept = _tokens.size();
+  return (state[accept/64] & (uint64_t(1) << (accept % 64))) != 0;
+}
+
+// Tokens consuming a character outside the ASCII range
+template<typename CharT>
+void csGlob<CharT>::transitionMask(const CharT ch, uint64_t *mask) const
+{
+  std::fill(mask, mask + _numWords, uint64_t(0));
+  for(size_t i = 0; i < _tokens.size(); i++) {
+    const Token& token = _tokens[i];
+    if( (token.type == Token::Literal  &&  token.ch == ch)  ||
+        token.type == Token::Any  ||
+        (token.type == Token::Set  &&  isSetMember(token, ch)) ) {
+      mask[i/64] |= uint64_t(1) << (i % 64);
+    }
+  }
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csGlob<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csGlob<wchar_t>;
+#endif
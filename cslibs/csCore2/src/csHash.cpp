@@ -0,0 +1,231 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstring>
+
+#include "csCore2/csHash.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_hash {
+
+  const uint64_t PRIME1 = 0x9E3779B185EBCA87;
+  const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4F;
+  const uint64_t PRIME3 = 0x165667B19E3779F9;
+  const uint64_t PRIME4 = 0x85EBCA77C2B2AE63;
+  const uint64_t PRIME5 = 0x27D4EB2F165667C5;
+
+  // Bytes consumed by one round of all four accumulators
+  const size_t STRIPE_SIZE = 32;
+
+  inline uint64_t rotl(const uint64_t x, const int n)
+  {
+    return (x << n) | (x >> (64 - n));
+  }
+
+  inline uint64_t read64(const uint8_t *p)
+  {
+    uint64_t x;
+    memcpy(&x, p, sizeof(x));
+    return x;
+  }
+
+  inline uint32_t read32(const uint8_t *p)
+  {
+    uint32_t x;
+    memcpy(&x, p, sizeof(x));
+    return x;
+  }
+
+  inline uint64_t accumulate(uint64_t acc, const uint64_t input)
+  {
+    acc += input*PRIME2;
+    acc  = rotl(acc, 31);
+    return acc*PRIME1;
+  }
+
+  inline uint64_t mergeRound(uint64_t h, const uint64_t acc)
+  {
+    h ^= accumulate(0, acc);
+    return h*PRIME1 + PRIME4;
+  }
+
+  inline void initialize(uint64_t *acc, const uint64_t seed)
+  {
+    acc[0] = seed + PRIME1 + PRIME2;
+    acc[1] = seed + PRIME2;
+    acc[2] = seed;
+    acc[3] = seed - PRIME1;
+  }
+
+  // Consumes all complete stripes; returns the number of bytes consumed.
+  inline size_t consumeStripes(uint64_t *acc, const uint8_t *p, const size_t numBytes)
+  {
+    uint64_t a0 = acc[0];
+    uint64_t a1 = acc[1];
+    uint64_t a2 = acc[2];
+    uint64_t a3 = acc[3];
+
+    size_t i = 0;
+    for(; i + STRIPE_SIZE <= numBytes; i += STRIPE_SIZE) {
+      a0 = accumulate(a0, read64(p + i));
+      a1 = accumulate(a1, read64(p + i +  8));
+      a2 = accumulate(a2, read64(p + i + 16));
+      a3 = accumulate(a3, read64(p + i + 24));
+    }
+
+    acc[0] = a0;
+    acc[1] = a1;
+    acc[2] = a2;
+    acc[3] = a3;
+
+    return i;
+  }
+
+  inline uint64_t mergeAccumulators(const uint64_t *acc)
+  {
+    uint64_t h = rotl(acc[0], 1) + rotl(acc[1], 7) + rotl(acc[2], 12) + rotl(acc[3], 18);
+    h = mergeRound(h, acc[0]);
+    h = mergeRound(h, acc[1]);
+    h = mergeRound(h, acc[2]);
+    h = mergeRound(h, acc[3]);
+    return h;
+  }
+
+  // Mixes in the remaining (< STRIPE_SIZE) bytes and avalanches h.
+  inline uint64_t finalize(uint64_t h, const uint8_t *p, size_t numBytes)
+  {
+    for(; numBytes >= 8; numBytes -= 8, p += 8) {
+      h ^= accumulate(0, read64(p));
+      h  = rotl(h, 27)*PRIME1 + PRIME4;
+    }
+    if( numBytes >= 4 ) {
+      h ^= uint64_t(read32(p))*PRIME1;
+      h  = rotl(h, 23)*PRIME2 + PRIME3;
+      numBytes -= 4;
+      p        += 4;
+    }
+    for(; numBytes > 0; numBytes--, p++) {
+      h ^= uint64_t(*p)*PRIME5;
+      h  = rotl(h, 11)*PRIME1;
+    }
+
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME3;
+    h ^= h >> 32;
+
+    return h;
+  }
+
+}; // namespace priv_hash
+
+////// Implementation ////////////////////////////////////////////////////////
+
+CS_CORE2_EXPORT uint64_t csHashBytes(const void *data, const size_t numBytes,
+                                     const uint64_t seed)
+{
+  using namespace priv_hash;
+
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(data);
+
+  uint64_t h;
+  size_t consumed = 0;
+  if( numBytes >= STRIPE_SIZE ) {
+    uint64_t acc[4];
+    initialize(acc, seed);
+    consumed = consumeStripes(acc, p, numBytes);
+    h = mergeAccumulators(acc);
+  } else {
+    h = seed + PRIME5;
+  }
+  h += uint64_t(numBytes);
+
+  return finalize(h, p + consumed, numBytes - consumed);
+}
+
+csHasher::csHasher(const uint64_t seed)
+{
+  reset(seed);
+}
+
+csHasher::~csHasher()
+{
+}
+
+void csHasher::reset(const uint64_t seed)
+{
+  priv_hash::initialize(_acc, seed);
+  _bufferSize = 0;
+  _seed       = seed;
+  _totalBytes = 0;
+}
+
+uint64_t csHasher::result() const
+{
+  using namespace priv_hash;
+
+  uint64_t h = _totalBytes >= STRIPE_SIZE
+      ? mergeAccumulators(_acc)
+      : _seed + PRIME5;
+  h += _totalBytes;
+
+  return finalize(h, _buffer, _bufferSize);
+}
+
+void csHasher::updateBytes(const void *data, const size_t numBytes)
+{
+  using namespace priv_hash;
+
+  const uint8_t *p = reinterpret_cast<const uint8_t*>(data);
+  size_t count     = numBytes;
+
+  _totalBytes += numBytes;
+
+  if( _bufferSize > 0 ) {
+    const size_t fill = std::min(STRIPE_SIZE - _bufferSize, count);
+    memcpy(_buffer + _bufferSize, p, fill);
+    _bufferSize += fill;
+    p           += fill;
+    count       -= fill;
+
+    if( _bufferSize < STRIPE_SIZE ) {
+      return;
+    }
+    consumeStripes(_acc, _buffer, STRIPE_SIZE);
+    _bufferSize = 0;
+  }
+
+  const size_t consumed = consumeStripes(_acc, p, count);
+  _bufferSize = count - consumed;
+  memcpy(_buffer, p + consumed, _bufferSize);
+}
@@ -36,3 +36,9 @@ int32_t csLimits<int32_t>::Max = INT32_MAX;
 
 uint32_t csLimits<uint32_t>::Min = 0;
 uint32_t csLimits<uint32_t>::Max = UINT32_MAX;
+
+int64_t csLimits<int64_t>::Min = INT64_MIN;
+int64_t csLimits<int64_t>::Max = INT64_MAX;
+
+uint64_t csLimits<uint64_t>::Min = 0;
+uint64_t csLimits<uint64_t>::Max = UINT64_MAX;
@@ -0,0 +1,195 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <algorithm>
+
+#include "csCore2/csMappedFile.h"
+#include "internal/mappedfile.h"
+
+////// Implementation - csMappedView /////////////////////////////////////////
+
+csMappedView::csMappedView() noexcept
+  : _data(0)
+  , _size(0)
+{
+}
+
+csMappedView::csMappedView(const std::shared_ptr<priv_mappedfile::Mapping>& mapping,
+                           const uint8_t *data, const size_t size) noexcept
+  : _mapping(mapping)
+  , _data(data)
+  , _size(size)
+{
+}
+
+csMappedView::~csMappedView()
+{
+}
+
+bool csMappedView::empty() const
+{
+  return _size == 0;
+}
+
+size_t csMappedView::size() const
+{
+  return _size;
+}
+
+const uint8_t *csMappedView::data() const
+{
+  return _data;
+}
+
+const uint8_t *csMappedView::begin() const
+{
+  return _data;
+}
+
+const uint8_t *csMappedView::end() const
+{
+  return _data + _size;
+}
+
+std::string_view csMappedView::toStringView() const
+{
+  return std::string_view(reinterpret_cast<const char*>(_data), _size);
+}
+
+csMappedView csMappedView::mid(const size_t offset, const size_t length) const
+{
+  if( offset >= _size ) {
+    return csMappedView();
+  }
+  return csMappedView(_mapping, _data + offset, std::min(length, _size - offset));
+}
+
+bool csMappedView::advise(const csMapAdvice advice) const
+{
+  return priv_mappedfile::advise(_data, _size, advice);
+}
+
+////// Implementation - csMappedFile /////////////////////////////////////////
+
+csMappedFile::csMappedFile() noexcept
+  : _data(0)
+  , _size(0)
+  , _isWritable(false)
+{
+}
+
+csMappedFile::csMappedFile(csMappedFile&& other) noexcept
+  : _mapping(std::move(other._mapping))
+  , _data(other._data)
+  , _size(other._size)
+  , _isWritable(other._isWritable)
+{
+  other._data       = 0;
+  other._size       = 0;
+  other._isWritable = false;
+}
+
+csMappedFile::~csMappedFile()
+{
+}
+
+csMappedFile& csMappedFile::operator=(csMappedFile&& other) noexcept
+{
+  if( this != &other ) {
+    _mapping    = std::move(other._mapping);
+    _data       = other._data;
+    _size       = other._size;
+    _isWritable = other._isWritable;
+
+    other._data       = 0;
+    other._size       = 0;
+    other._isWritable = false;
+  }
+  return *this;
+}
+
+bool csMappedFile::open(const wchar_t *filename, const csMapAccess access,
+                        const unsigned int flags)
+{
+  return map(filename, access, flags, false, 0);
+}
+
+bool csMappedFile::create(const wchar_t *filename, const size_t size,
+                          const unsigned int flags)
+{
+  return map(filename, csMapReadWrite, flags, true, size);
+}
+
+void csMappedFile::close()
+{
+  _mapping.reset();
+  _data       = 0;
+  _size       = 0;
+  _isWritable = false;
+}
+
+bool csMappedFile::isOpen() const
+{
+  return bool(_mapping);
+}
+
+bool csMappedFile::isWritable() const
+{
+  return _isWritable;
+}
+
+size_t csMappedFile::size() const
+{
+  return _size;
+}
+
+const uint8_t *csMappedFile::data() const
+{
+  return _data;
+}
+
+uint8_t *csMappedFile::writableData()
+{
+  return _isWritable
+      ? _data
+      : 0;
+}
+
+csMappedView csMappedFile::view(const size_t offset, const size_t length) const
+{
+  return csMappedView(_mapping, _data, _size).mid(offset, length);
+}
+
+bool csMappedFile::advise(const csMapAdvice advice,
+                          const size_t offset, const size_t length) const
+{
+  return view(offset, length).advise(advice);
+}
@@ -0,0 +1,198 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "csCore2/csMappedFile.h"
+#include "csCore2/csUtf.h"
+#include "internal/mappedfile.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_mappedfile {
+
+  struct Mapping {
+    Mapping(void *address, const size_t size)
+      : address(address)
+      , size(size)
+    {
+    }
+
+    ~Mapping()
+    {
+      if( address != 0 ) {
+        munmap(address, size);
+      }
+    }
+
+    void *address;
+    size_t size;
+  };
+
+  uintptr_t pageSize()
+  {
+    static const uintptr_t size = uintptr_t(sysconf(_SC_PAGESIZE));
+    return size;
+  }
+
+  bool advise(const uint8_t *data, const size_t size, const csMapAdvice advice)
+  {
+    if( data == 0  ||  size == 0 ) {
+      return true;
+    }
+
+    int posixAdvice = MADV_NORMAL;
+    if(        advice == csMapAdviceSequential ) {
+      posixAdvice = MADV_SEQUENTIAL;
+    } else if( advice == csMapAdviceRandom ) {
+      posixAdvice = MADV_RANDOM;
+    } else if( advice == csMapAdviceWillNeed ) {
+      posixAdvice = MADV_WILLNEED;
+    } else if( advice == csMapAdviceDontNeed ) {
+      posixAdvice = MADV_DONTNEED;
+    }
+
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(data) & ~(pageSize() - 1);
+    const uintptr_t end   = reinterpret_cast<uintptr_t>(data) + size;
+
+    return madvise(reinterpret_cast<void*>(begin), end - begin, posixAdvice) == 0;
+  }
+
+}; // namespace priv_mappedfile
+
+////// Implementation ////////////////////////////////////////////////////////
+
+bool csMappedFile::flush(const bool async)
+{
+  if( !_isWritable ) {
+    return false;
+  }
+  if( _size == 0 ) {
+    return true;
+  }
+  return msync(_data, _size, async  ?  MS_ASYNC : MS_SYNC) == 0;
+}
+
+////// private ///////////////////////////////////////////////////////////////
+
+bool csMappedFile::map(const wchar_t *filename, const csMapAccess access,
+                       const unsigned int flags, const bool isCreating, const size_t size)
+{
+  close();
+
+  if( filename == 0 ) {
+    return false;
+  }
+
+  csUtfResult result;
+  const std::string utf8 = csToUtf8(filename, &result);
+  if( result.error != csUtfNoError ) {
+    return false;
+  }
+
+  const bool isWritable = access == csMapReadWrite;
+  size_t mapSize = size;
+
+  int openFlags = O_CLOEXEC;
+  openFlags |= isWritable
+      ? O_RDWR
+      : O_RDONLY;
+  if( isCreating ) {
+    openFlags |= O_CREAT | O_TRUNC;
+  }
+
+  const int fd = ::open(utf8.data(), openFlags, 0644);
+  if( fd < 0 ) {
+    return false;
+  }
+
+  if( isCreating ) {
+    if( ftruncate(fd, off_t(size)) != 0 ) {
+      ::close(fd);
+      return false;
+    }
+  } else {
+    struct stat st;
+    if( fstat(fd, &st) != 0  ||  uint64_t(st.st_size) > uint64_t(SIZE_MAX) ) {
+      ::close(fd);
+      return false;
+    }
+    mapSize = size_t(st.st_size);
+  }
+
+  void *address = 0;
+  if( mapSize > 0 ) {
+    int mapFlags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if( (flags & csMapPopulate) != 0 ) {
+      mapFlags |= MAP_POPULATE;
+    }
+#endif
+
+    const int protection = isWritable
+        ? PROT_READ | PROT_WRITE
+        : PROT_READ;
+
+    address = mmap(0, mapSize, protection, mapFlags, fd, 0);
+    if( address == MAP_FAILED ) {
+      ::close(fd);
+      return false;
+    }
+  }
+
+  // NOTE: The mapping keeps the file referenced.
+  ::close(fd);
+
+  _mapping    = std::make_shared<priv_mappedfile::Mapping>(address, mapSize);
+  _data       = static_cast<uint8_t*>(address);
+  _size       = mapSize;
+  _isWritable = isWritable;
+
+  // NOTE: Huge pages of file mappings depend on the file system (and on
+  //       Linux, on transparent huge pages); the hint may be refused.
+#ifdef MADV_HUGEPAGE
+  if( (flags & csMapHugePages) != 0  &&  mapSize > 0 ) {
+    madvise(address, mapSize, MADV_HUGEPAGE);
+  }
+#endif
+#ifndef MAP_POPULATE
+  if( (flags & csMapPopulate) != 0 ) {
+    priv_mappedfile::advise(_data, _size, csMapAdviceWillNeed);
+  }
+#endif
+
+  return true;
+}
@@ -0,0 +1,168 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <Windows.h>
+
+#include "csCore2/csMappedFile.h"
+#include "internal/mappedfile.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_mappedfile {
+
+  struct Mapping {
+    Mapping(const HANDLE file, const HANDLE mapping, void *address)
+      : file(file)
+      , mapping(mapping)
+      , address(address)
+    {
+    }
+
+    ~Mapping()
+    {
+      if( address != 0 ) {
+        UnmapViewOfFile(address);
+      }
+      if( mapping != 0 ) {
+        CloseHandle(mapping);
+      }
+      CloseHandle(file);
+    }
+
+    HANDLE file;
+    HANDLE mapping;
+    void *address;
+  };
+
+  // NOTE: Windows offers no hints beyond prefetching a range.
+  bool advise(const uint8_t *data, const size_t size, const csMapAdvice advice)
+  {
+    if( data == 0  ||  size == 0 ) {
+      return true;
+    }
+    if( advice != csMapAdviceWillNeed ) {
+      return false;
+    }
+
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<uint8_t*>(data);
+    range.NumberOfBytes  = size;
+    return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != 0;
+  }
+
+}; // namespace priv_mappedfile
+
+////// Implementation ////////////////////////////////////////////////////////
+
+bool csMappedFile::flush(const bool async)
+{
+  if( !_isWritable ) {
+    return false;
+  }
+  if( _size > 0  &&  FlushViewOfFile(_data, _size) == 0 ) {
+    return false;
+  }
+  return async  ||  FlushFileBuffers(_mapping->file) != 0;
+}
+
+////// private ///////////////////////////////////////////////////////////////
+
+bool csMappedFile::map(const wchar_t *filename, const csMapAccess access,
+                       const unsigned int flags, const bool isCreating, const size_t size)
+{
+  close();
+
+  if( filename == 0 ) {
+    return false;
+  }
+
+  const bool isWritable = access == csMapReadWrite;
+
+  const DWORD desiredAccess = isWritable
+      ? GENERIC_READ | GENERIC_WRITE
+      : GENERIC_READ;
+  const DWORD creation = isCreating
+      ? CREATE_ALWAYS
+      : OPEN_EXISTING;
+  const HANDLE file = CreateFileW(filename, desiredAccess,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  0, creation, FILE_ATTRIBUTE_NORMAL, 0);
+  if( file == INVALID_HANDLE_VALUE ) {
+    return false;
+  }
+
+  LARGE_INTEGER fileSize;
+  if( isCreating ) {
+    fileSize.QuadPart = LONGLONG(size);
+    if( SetFilePointerEx(file, fileSize, 0, FILE_BEGIN) == 0  ||  SetEndOfFile(file) == 0 ) {
+      CloseHandle(file);
+      return false;
+    }
+  } else if( GetFileSizeEx(file, &fileSize) == 0  ||
+             uint64_t(fileSize.QuadPart) > uint64_t(SIZE_MAX) ) {
+    CloseHandle(file);
+    return false;
+  }
+  const size_t mapSize = size_t(fileSize.QuadPart);
+
+  // NOTE: Files of size zero cannot be mapped.
+  HANDLE mapping = 0;
+  void *address = 0;
+  if( mapSize > 0 ) {
+    // NOTE: Large pages are only available for mappings backed by the
+    //       paging file; csMapHugePages is ignored.
+    mapping = CreateFileMappingW(file, 0, isWritable  ?  PAGE_READWRITE : PAGE_READONLY,
+                                 0, 0, 0);
+    if( mapping == 0 ) {
+      CloseHandle(file);
+      return false;
+    }
+
+    address = MapViewOfFile(mapping, isWritable  ?  FILE_MAP_WRITE : FILE_MAP_READ,
+                            0, 0, mapSize);
+    if( address == 0 ) {
+      CloseHandle(mapping);
+      CloseHandle(file);
+      return false;
+    }
+  }
+
+  _mapping    = std::make_shared<priv_mappedfile::Mapping>(file, mapping, address);
+  _data       = static_cast<uint8_t*>(address);
+  _size       = mapSize;
+  _isWritable = isWritable;
+
+  if( (flags & csMapPopulate) != 0 ) {
+    priv_mappedfile::advise(_data, _size, csMapAdviceWillNeed);
+  }
+
+  return true;
+}
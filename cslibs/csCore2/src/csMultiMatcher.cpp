@@ -0,0 +1,422 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "csCore2/csMultiMatcher.h"
+
+#include "csCore2/csChar.h"
+#include "csCore2/csUtil.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_multimatcher {
+
+  template<typename CharT>
+  inline size_t toIndex(const CharT ch)
+  {
+    return size_t(typename std::make_unsigned<CharT>::type(ch));
+  }
+
+  struct TrieNode {
+    std::vector<std::pair<uint16_t,uint32_t>> children; // sorted by class
+    std::vector<uint32_t> patterns;
+  };
+
+  template<typename T>
+  inline size_t capacityBytes(const std::vector<T>& v)
+  {
+    return v.capacity()*sizeof(T);
+  }
+
+  const size_t NARROW_SIZE = 256;
+  const size_t LINEAR_EDGES = 8;
+
+  // NOTE: Limits the complete transitions to 4MiB. Scanning spends most
+  //       time near the root, where the states are dense and come first.
+  const size_t MAX_DENSE_ENTRIES = 1024*1024;
+
+}; // namespace priv_multimatcher
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csMultiMatcher<CharT>::csMultiMatcher()
+  : _patterns()
+  , _ignoreCase(false)
+  , _isCompiled(false)
+  , _numClasses(0)
+  , _numDense(0)
+{
+}
+
+template<typename CharT>
+csMultiMatcher<CharT>::~csMultiMatcher()
+{
+}
+
+template<typename CharT>
+size_t csMultiMatcher<CharT>::addPattern(const csBasicStringView<CharT>& pattern)
+{
+  _isCompiled = false;
+  _patterns.emplace_back(pattern.data(), pattern.size());
+  return _patterns.size() - 1;
+}
+
+template<typename CharT>
+void csMultiMatcher<CharT>::clear()
+{
+  _patterns.clear();
+  _isCompiled = false;
+
+  _narrowClass.clear();
+  _wideChars.clear();
+  _wideClass.clear();
+  _numClasses = 0;
+
+  _numDense = 0;
+  _denseNext.clear();
+  _edgeBegin.clear();
+  _edgeClass.clear();
+  _edgeTarget.clear();
+  _fail.clear();
+  _dictLink.clear();
+  _outBegin.clear();
+  _outPattern.clear();
+}
+
+template<typename CharT>
+bool csMultiMatcher<CharT>::compile(const bool ignoreCase)
+{
+  using namespace priv_multimatcher;
+
+  std::vector<std::basic_string<CharT>> patterns;
+  patterns.swap(_patterns);
+  clear();
+  _patterns.swap(patterns);
+
+  _ignoreCase = ignoreCase;
+
+  // (1) Alphabet ////////////////////////////////////////////////////////////
+
+  std::vector<CharT> chars;
+  for(const std::basic_string<CharT>& pattern : _patterns) {
+    for(const CharT ch : pattern) {
+      chars.push_back(_ignoreCase  ?  csToLower(ch) : ch);
+    }
+  }
+  std::sort(chars.begin(), chars.end());
+  chars.erase(std::unique(chars.begin(), chars.end()), chars.end());
+  if( chars.empty()  ||  chars.size() > 0xFFFF ) {
+    return false;
+  }
+
+  _numClasses = chars.size() + 1;
+  _narrowClass.assign(NARROW_SIZE, 0);
+  for(size_t i = 0; i < chars.size(); i++) {
+    const uint16_t cls = uint16_t(i + 1);
+    if( toIndex(chars[i]) < NARROW_SIZE ) {
+      _narrowClass[toIndex(chars[i])] = cls;
+    } else {
+      _wideChars.push_back(chars[i]);
+      _wideClass.push_back(cls);
+    }
+  }
+
+  // Narrow characters are looked up without folding their case
+  if( _ignoreCase ) {
+    std::vector<uint16_t> folded(NARROW_SIZE, 0);
+    for(size_t i = 0; i < NARROW_SIZE; i++) {
+      folded[i] = uint16_t(classOf(csToLower(CharT(i))));
+    }
+    _narrowClass.swap(folded);
+  }
+
+  // (2) Trie ////////////////////////////////////////////////////////////////
+
+  std::vector<TrieNode> trie(1);
+  for(size_t id = 0; id < _patterns.size(); id++) {
+    if( _patterns[id].empty() ) {
+      continue;
+    }
+
+    uint32_t node = 0;
+    for(const CharT ch : _patterns[id]) {
+      const uint16_t cls = uint16_t(classOf(ch));
+      std::vector<std::pair<uint16_t,uint32_t>>& children = trie[node].children;
+      auto it = std::lower_bound(children.begin(), children.end(),
+                                 std::make_pair(cls, uint32_t(0)));
+      if( it == children.end()  ||  it->first != cls ) {
+        it = children.insert(it, std::make_pair(cls, uint32_t(trie.size())));
+        trie.emplace_back();
+      }
+      node = it->second;
+    }
+    trie[node].patterns.push_back(uint32_t(id));
+  }
+
+  // (3) Renumber states in breadth first order //////////////////////////////
+
+  std::vector<uint32_t> order(1, 0);
+  std::vector<uint32_t> newId(trie.size(), 0);
+  for(size_t q = 0; q < order.size(); q++) {
+    for(const std::pair<uint16_t,uint32_t>& child : trie[order[q]].children) {
+      newId[child.second] = uint32_t(order.size());
+      order.push_back(child.second);
+    }
+  }
+
+  const size_t numStates = order.size();
+  _edgeBegin.reserve(numStates + 1);
+  _edgeClass.reserve(numStates - 1);
+  _edgeTarget.reserve(numStates - 1);
+  _outBegin.reserve(numStates + 1);
+  for(const uint32_t old : order) {
+    _edgeBegin.push_back(uint32_t(_edgeClass.size()));
+    for(const std::pair<uint16_t,uint32_t>& child : trie[old].children) {
+      _edgeClass.push_back(child.first);
+      _edgeTarget.push_back(newId[child.second]);
+    }
+
+    _outBegin.push_back(uint32_t(_outPattern.size()));
+    _outPattern.insert(_outPattern.end(),
+                       trie[old].patterns.begin(), trie[old].patterns.end());
+  }
+  _edgeBegin.push_back(uint32_t(_edgeClass.size()));
+  _outBegin.push_back(uint32_t(_outPattern.size()));
+
+  trie.clear();
+  trie.shrink_to_fit();
+
+  // The root's transitions are needed to compute the failure links.
+  _numDense = 1;
+  _denseNext.assign(_numClasses, 0);
+  for(uint32_t e = _edgeBegin[0]; e < _edgeBegin[1]; e++) {
+    _denseNext[_edgeClass[e]] = _edgeTarget[e];
+  }
+
+  // (4) Failure & dictionary links //////////////////////////////////////////
+
+  _fail.assign(numStates, 0);
+  _dictLink.assign(numStates, 0);
+  for(uint32_t state = 0; state < uint32_t(numStates); state++) {
+    for(uint32_t e = _edgeBegin[state]; e < _edgeBegin[state + 1]; e++) {
+      const uint32_t target = _edgeTarget[e];
+      const uint32_t fail   = state != 0
+          ? next(_fail[state], _edgeClass[e])
+          : 0;
+      _fail[target]     = fail;
+      _dictLink[target] = _outBegin[fail] != _outBegin[fail + 1]
+          ? fail
+          : _dictLink[fail];
+    }
+  }
+
+  // (5) Complete transitions of the first states ////////////////////////////
+
+  // NOTE: A failure link leads to a shallower state, i.e. one numbered
+  //       lower, whose row is complete already.
+  const size_t numDense = csMin(numStates, csMax<size_t>(MAX_DENSE_ENTRIES/_numClasses, 1));
+  _denseNext.resize(numDense*_numClasses);
+  for(size_t state = 1; state < numDense; state++) {
+    uint32_t       *row  = _denseNext.data() + state*_numClasses;
+    const uint32_t *fail = _denseNext.data() + size_t(_fail[state])*_numClasses;
+    std::copy(fail, fail + _numClasses, row);
+    for(uint32_t e = _edgeBegin[state]; e < _edgeBegin[state + 1]; e++) {
+      row[_edgeClass[e]] = _edgeTarget[e];
+    }
+  }
+  _numDense = numDense;
+
+  _isCompiled = true;
+
+  return true;
+}
+
+template<typename CharT>
+bool csMultiMatcher<CharT>::isCompiled() const
+{
+  return _isCompiled;
+}
+
+template<typename CharT>
+size_t csMultiMatcher<CharT>::memoryUsage() const
+{
+  using namespace priv_multimatcher;
+
+  return
+      capacityBytes(_narrowClass) + capacityBytes(_wideChars) + capacityBytes(_wideClass) +
+      capacityBytes(_denseNext) + capacityBytes(_edgeBegin) + capacityBytes(_edgeClass) +
+      capacityBytes(_edgeTarget) + capacityBytes(_fail) + capacityBytes(_dictLink) +
+      capacityBytes(_outBegin) + capacityBytes(_outPattern);
+}
+
+template<typename CharT>
+const std::basic_string<CharT>& csMultiMatcher<CharT>::pattern(const size_t i) const
+{
+  return _patterns[i];
+}
+
+template<typename CharT>
+size_t csMultiMatcher<CharT>::patternCount() const
+{
+  return _patterns.size();
+}
+
+template<typename CharT>
+bool csMultiMatcher<CharT>::containsAny(const csBasicStringView<CharT>& text) const
+{
+  Cursor cursor;
+  return !scan(text.data(), text.size(), &cursor, [](const csMultiMatch&) -> bool {
+    return false;
+  });
+}
+
+template<typename CharT>
+std::vector<csMultiMatch> csMultiMatcher<CharT>::findAll(const csBasicStringView<CharT>& text) const
+{
+  std::vector<csMultiMatch> matches;
+  Cursor cursor;
+  scan(text.data(), text.size(), &cursor, [&matches](const csMultiMatch& match) -> bool {
+    matches.push_back(match);
+    return true;
+  });
+  return matches;
+}
+
+template<typename CharT>
+bool csMultiMatcher<CharT>::scan(const CharT *data, const size_t len, Cursor *cursor,
+                                 const MatchFunc& func) const
+{
+  if( !_isCompiled  ||  data == 0  ||  cursor == 0 ) {
+    return true;
+  }
+
+  uint32_t state = cursor->state;
+  for(size_t i = 0; i < len; i++) {
+    state = next(state, classOf(data[i]));
+
+    uint32_t out = _outBegin[state] != _outBegin[state + 1]
+        ? state
+        : _dictLink[state];
+    while( out != 0 ) {
+      for(uint32_t k = _outBegin[out]; k < _outBegin[out + 1]; k++) {
+        csMultiMatch match;
+        match.pattern = _outPattern[k];
+        match.offset  = cursor->offset + i + 1 - _patterns[match.pattern].size();
+        if( !func(match) ) {
+          cursor->state   = state;
+          cursor->offset += i + 1;
+          return false;
+        }
+      }
+      out = _dictLink[out];
+    }
+  }
+
+  cursor->state   = state;
+  cursor->offset += len;
+
+  return true;
+}
+
+////// private ///////////////////////////////////////////////////////////////
+
+template<typename CharT>
+inline uint32_t csMultiMatcher<CharT>::classOf(const CharT ch) const
+{
+  using namespace priv_multimatcher;
+
+  if( toIndex(ch) < NARROW_SIZE ) {
+    return _narrowClass[toIndex(ch)];
+  }
+
+  const CharT key = _ignoreCase  ?  csToLower(ch) : ch;
+  if( toIndex(key) < NARROW_SIZE ) {
+    return _narrowClass[toIndex(key)];
+  }
+
+  const typename std::vector<CharT>::const_iterator it =
+      std::lower_bound(_wideChars.begin(), _wideChars.end(), key);
+  if( it == _wideChars.end()  ||  *it != key ) {
+    return 0;
+  }
+  return _wideClass[size_t(it - _wideChars.begin())];
+}
+
+template<typename CharT>
+inline uint32_t csMultiMatcher<CharT>::next(uint32_t state, const uint32_t cls) const
+{
+  using namespace priv_multimatcher;
+
+  if( cls == 0 ) {
+    return 0;
+  }
+
+  while( state >= _numDense ) {
+    const uint16_t *first = _edgeClass.data() + _edgeBegin[state];
+    const uint16_t *last  = _edgeClass.data() + _edgeBegin[state + 1];
+    const uint16_t *hit   = last;
+    if( last - first <= ptrdiff_t(LINEAR_EDGES) ) {
+      for(const uint16_t *e = first; e != last; e++) {
+        if( *e == cls ) {
+          hit = e;
+          break;
+        }
+      }
+    } else {
+      hit = std::lower_bound(first, last, uint16_t(cls));
+      if( hit != last  &&  *hit != cls ) {
+        hit = last;
+      }
+    }
+
+    if( hit != last ) {
+      return _edgeTarget[size_t(hit - _edgeClass.data())];
+    }
+
+    state = _fail[state];
+  }
+
+  return _denseNext[size_t(state)*_numClasses + cls];
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csMultiMatcher<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csMultiMatcher<wchar_t>;
+#endif
@@ -0,0 +1,409 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstring>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "csCore2/csNaturalSort.h"
+
+#include "internal/parallel.h"
+
+#include "csCore2/csChar.h"
+#include "csCore2/csUtil.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_naturalsort {
+
+  // Smaller lists are not worth the threads' start-up
+  const size_t MIN_CHUNK_SIZE = 16*1024;
+
+  // Segment tags of the sort key, in ascending order
+  enum Tag : unsigned char {
+    TAG_END = 0,
+    TAG_BELOW_DIGITS,
+    TAG_NUMBER,
+    TAG_ABOVE_DIGITS
+  };
+
+  // Counts of up to this value are encoded in a single byte
+  const size_t MAX_SHORT_COUNT = 0xFE;
+
+  template<typename CharT>
+  inline bool isDigit(const CharT ch)
+  {
+    return CharT('0') <= ch  &&  ch <= CharT('9');
+  }
+
+  template<typename CharT>
+  inline typename std::make_unsigned<CharT>::type toUnit(const CharT ch, const bool ignoreCase)
+  {
+    typedef typename std::make_unsigned<CharT>::type UnitT;
+    return ignoreCase
+        ? UnitT(csToLower(ch))
+        : UnitT(ch);
+  }
+
+  template<typename CharT>
+  inline Tag tagOf(const CharT ch)
+  {
+    typedef typename std::make_unsigned<CharT>::type UnitT;
+    return UnitT(ch) < UnitT('0')
+        ? TAG_BELOW_DIGITS
+        : TAG_ABOVE_DIGITS;
+  }
+
+  // Run of digits starting at s[0]
+  struct Run {
+    size_t length;  // all digits
+    size_t zeros;   // leading zeros
+  };
+
+  template<typename CharT>
+  inline Run scanRun(const CharT *s, const size_t len)
+  {
+    size_t zeros = 0;
+    while( zeros < len  &&  s[zeros] == CharT('0') ) {
+      zeros++;
+    }
+
+    size_t length = zeros;
+    while( length < len  &&  isDigit(s[length]) ) {
+      length++;
+    }
+
+    return Run{length, zeros};
+  }
+
+  template<typename CharT>
+  inline int compareRuns(const CharT *s1, const Run& r1,
+                         const CharT *s2, const Run& r2)
+  {
+    const size_t num1 = r1.length - r1.zeros;
+    const size_t num2 = r2.length - r2.zeros;
+    if( num1 != num2 ) {
+      return num1 < num2
+          ? -1
+          : 1;
+    }
+
+    for(size_t i = 0; i < num1; i++) {
+      const CharT d1 = s1[r1.zeros + i];
+      const CharT d2 = s2[r2.zeros + i];
+      if( d1 != d2 ) {
+        return d1 < d2
+            ? -1
+            : 1;
+      }
+    }
+
+    return 0;
+  }
+
+  // Big endian, so that memcmp() orders as the value
+  inline void putCount(std::string *key, const size_t count)
+  {
+    if( count <= MAX_SHORT_COUNT ) {
+      key->push_back(char(count));
+      return;
+    }
+
+    key->push_back(char(0xFF));
+    for(int shift = 56; shift >= 0; shift -= 8) {
+      key->push_back(char(uint64_t(count) >> shift));
+    }
+  }
+
+  template<typename CharT>
+  inline void putUnit(std::string *key, const CharT ch, const bool ignoreCase)
+  {
+    const auto unit = toUnit(ch, ignoreCase);
+    for(int shift = int(8*(sizeof(CharT) - 1)); shift >= 0; shift -= 8) {
+      key->push_back(char(unit >> shift));
+    }
+  }
+
+  ////// Sorting /////////////////////////////////////////////////////////////
+
+  template<typename IterT>
+  struct Item {
+    const char *key;
+    size_t keySize;
+    IterT iter;
+  };
+
+  template<typename IterT>
+  inline bool isLess(const Item<IterT>& a, const Item<IterT>& b)
+  {
+    const int cmp = std::memcmp(a.key, b.key, std::min(a.keySize, b.keySize));
+    return cmp != 0
+        ? cmp < 0
+        : a.keySize < b.keySize;
+  }
+
+  // Merges pairs of adjacent sorted ranges, in parallel, until one remains
+  template<typename IterT>
+  void mergeRanges(std::vector<Item<IterT>>& items, std::vector<size_t> bounds)
+  {
+    std::vector<Item<IterT>> merged(items.size());
+
+    while( bounds.size() > 2 ) {
+      const size_t numRanges = bounds.size() - 1;
+
+      priv_parallel::run(numRanges/2, [&](const size_t i) -> void {
+        const size_t begin = bounds[2*i];
+        const size_t mid   = bounds[2*i + 1];
+        const size_t end   = bounds[2*i + 2];
+        std::merge(items.begin() + begin, items.begin() + mid,
+                   items.begin() + mid,   items.begin() + end,
+                   merged.begin() + begin, isLess<IterT>);
+      });
+
+      std::vector<size_t> next;
+      for(size_t i = 0; i < numRanges; i += 2) {
+        next.push_back(bounds[i]);
+      }
+      if( numRanges % 2 != 0 ) {
+        // Odd one out: carried over unchanged
+        const size_t begin = bounds[numRanges - 1];
+        std::copy(items.begin() + begin, items.end(), merged.begin() + begin);
+      }
+      next.push_back(items.size());
+
+      items.swap(merged);
+      bounds.swap(next);
+    }
+  }
+
+}; // namespace priv_naturalsort
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+int csNaturalCmp(const CharT *s1, const size_t len1,
+                 const CharT *s2, const size_t len2,
+                 const bool ignoreCase)
+{
+  using namespace priv_naturalsort;
+
+  int leadingZeros = 0; // first difference in leading zeros
+
+  size_t i1 = 0;
+  size_t i2 = 0;
+  while( i1 < len1  &&  i2 < len2 ) {
+    const CharT ch1 = s1[i1];
+    const CharT ch2 = s2[i2];
+
+    const bool isDigit1 = isDigit(ch1);
+    const bool isDigit2 = isDigit(ch2);
+
+    if( isDigit1  &&  isDigit2 ) {
+      const Run run1 = scanRun(s1 + i1, len1 - i1);
+      const Run run2 = scanRun(s2 + i2, len2 - i2);
+
+      const int cmp = compareRuns(s1 + i1, run1, s2 + i2, run2);
+      if( cmp != 0 ) {
+        return cmp;
+      }
+
+      if( leadingZeros == 0  &&  run1.zeros != run2.zeros ) {
+        leadingZeros = run1.zeros < run2.zeros
+            ? -1
+            : 1;
+      }
+
+      i1 += run1.length;
+      i2 += run2.length;
+
+    } else if( isDigit1 ) {
+      return tagOf(ch2) == TAG_BELOW_DIGITS
+          ? 1
+          : -1;
+
+    } else if( isDigit2 ) {
+      return tagOf(ch1) == TAG_BELOW_DIGITS
+          ? -1
+          : 1;
+
+    } else {
+      const auto unit1 = toUnit(ch1, ignoreCase);
+      const auto unit2 = toUnit(ch2, ignoreCase);
+      if( unit1 != unit2 ) {
+        return unit1 < unit2
+            ? -1
+            : 1;
+      }
+
+      i1++;
+      i2++;
+    }
+  }
+
+  if( i1 < len1 ) {
+    return 1;
+  } else if( i2 < len2 ) {
+    return -1;
+  }
+
+  return leadingZeros;
+}
+
+template<typename CharT>
+void csNaturalSortKey(std::string *key, const CharT *s, const size_t len,
+                      const bool ignoreCase)
+{
+  using namespace priv_naturalsort;
+
+  if( key == 0 ) {
+    return;
+  }
+
+  // (1) Primary key: the segments, i.e. single code units and whole numbers
+
+  size_t numRuns = 0;
+  for(size_t i = 0; i < len; ) {
+    if( isDigit(s[i]) ) {
+      const Run run = scanRun(s + i, len - i);
+
+      key->push_back(char(TAG_NUMBER));
+      putCount(key, run.length - run.zeros);
+      for(size_t j = run.zeros; j < run.length; j++) {
+        key->push_back(char(s[i + j]));
+      }
+
+      numRuns++;
+      i += run.length;
+
+    } else {
+      key->push_back(char(tagOf(s[i])));
+      putUnit(key, s[i], ignoreCase);
+
+      i++;
+    }
+  }
+
+  key->push_back(char(TAG_END));
+
+  // (2) Secondary key: the leading zeros of each number, in order
+
+  for(size_t i = 0; numRuns > 0  &&  i < len; ) {
+    if( isDigit(s[i]) ) {
+      const Run run = scanRun(s + i, len - i);
+      putCount(key, run.zeros);
+      numRuns--;
+      i += run.length;
+    } else {
+      i++;
+    }
+  }
+}
+
+template<class StringT>
+void csNaturalSort(csBasicStringList<StringT>& list, const bool ignoreCase,
+                   const int threadCount)
+{
+  using namespace priv_naturalsort;
+
+  typedef typename csBasicStringList<StringT>::iterator IterT;
+
+  const size_t numItems = list.size();
+  if( numItems < 2 ) {
+    return;
+  }
+
+  std::vector<Item<IterT>> items;
+  items.reserve(numItems);
+  for(IterT iter = list.begin(); iter != list.end(); ++iter) {
+    items.push_back(Item<IterT>{0, 0, iter});
+  }
+
+  // (1) Each chunk builds its keys in one buffer, then sorts itself
+
+  const size_t numChunks = csBound<size_t>(1, numItems/MIN_CHUNK_SIZE,
+                                           priv_parallel::threadCount(threadCount));
+
+  std::vector<size_t> bounds;
+  for(size_t i = 0; i <= numChunks; i++) {
+    bounds.push_back(numItems*i/numChunks);
+  }
+
+  std::vector<std::string> keys(numChunks);
+
+  priv_parallel::run(numChunks, [&](const size_t i) -> void {
+    std::string& buffer = keys[i];
+
+    std::vector<size_t> offsets;
+    offsets.reserve(bounds[i + 1] - bounds[i] + 1);
+    for(size_t j = bounds[i]; j < bounds[i + 1]; j++) {
+      offsets.push_back(buffer.size());
+      const StringT& s = *items[j].iter;
+      csNaturalSortKey(&buffer, s.data(), s.size(), ignoreCase);
+    }
+    offsets.push_back(buffer.size());
+
+    // NOTE: The buffer no longer grows; pointers into it remain valid.
+    for(size_t j = bounds[i]; j < bounds[i + 1]; j++) {
+      const size_t k = j - bounds[i];
+      items[j].key     = buffer.data() + offsets[k];
+      items[j].keySize = offsets[k + 1] - offsets[k];
+    }
+
+    std::sort(items.begin() + bounds[i], items.begin() + bounds[i + 1], isLess<IterT>);
+  });
+
+  // (2) Merge the chunks
+
+  mergeRanges(items, bounds);
+
+  // (3) Relink the nodes in sorted order
+
+  for(const Item<IterT>& item : items) {
+    list.splice(list.end(), list, item.iter);
+  }
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template CS_CORE2_EXPORT int csNaturalCmp<char>(const char *s1, const size_t len1, const char *s2, const size_t len2, const bool ignoreCase);
+template CS_CORE2_EXPORT void csNaturalSortKey<char>(std::string *key, const char *s, const size_t len, const bool ignoreCase);
+template CS_CORE2_EXPORT void csNaturalSort<csString>(csBasicStringList<csString>& list, const bool ignoreCase, const int threadCount);
+#endif
+
+#ifdef HAVE_WCHAR_T
+template CS_CORE2_EXPORT int csNaturalCmp<wchar_t>(const wchar_t *s1, const size_t len1, const wchar_t *s2, const size_t len2, const bool ignoreCase);
+template CS_CORE2_EXPORT void csNaturalSortKey<wchar_t>(std::string *key, const wchar_t *s, const size_t len, const bool ignoreCase);
+template CS_CORE2_EXPORT void csNaturalSort<csWString>(csBasicStringList<csWString>& list, const bool ignoreCase, const int threadCount);
+#endif
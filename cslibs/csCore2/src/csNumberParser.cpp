@@ -0,0 +1,396 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <thread>
+#include <vector>
+
+#include "csCore2/csNumberParser.h"
+
+#include "internal/cpu.h"
+#include "internal/parallel.h"
+#include "internal/simd_string.h"
+
+#include "csCore2/csUtil.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_numberparser {
+
+  const size_t BLOCK_SIZE = 64;
+
+  // Smaller buffers are not worth the threads' start-up
+  const size_t MIN_CHUNK_SIZE = 256*1024;
+
+  // Tokenizes s using the delimiter masks of aligned blocks of 64 characters;
+  // the most recently used block's mask is cached.
+  template<typename CharT>
+  class Scanner {
+  public:
+    Scanner(const CharT *s, const size_t len, const std::basic_string<CharT>& delimiters)
+      : _s(s)
+      , _len(len)
+      , _set(delimiters.data())
+      , _setLen(delimiters.size())
+      , _block(SIZE_MAX)
+      , _mask(0)
+    {
+    }
+
+    // Index of the first delimiter at or after pos, or the length
+    size_t findDelimiter(size_t pos)
+    {
+      while( pos < _len ) {
+        const size_t   block = pos & ~(BLOCK_SIZE - 1);
+        const uint64_t mask  = delimiterMask(block) >> (pos - block);
+        if( mask != 0 ) {
+          return pos + size_t(priv_cpu::ctz64(mask));
+        }
+        pos = block + BLOCK_SIZE;
+      }
+      return _len;
+    }
+
+    // Index of the first non-delimiter at or after pos, or the length
+    size_t findToken(size_t pos)
+    {
+      while( pos < _len ) {
+        const size_t   block = pos & ~(BLOCK_SIZE - 1);
+        const uint64_t mask  = ~delimiterMask(block) >> (pos - block);
+        if( mask != 0 ) {
+          return pos + size_t(priv_cpu::ctz64(mask));
+        }
+        pos = block + BLOCK_SIZE;
+      }
+      return _len;
+    }
+
+    size_t countTokens()
+    {
+      size_t   count = 0;
+      uint64_t carry = 1; // Virtual delimiter preceding s
+      for(size_t block = 0; block < _len; block += BLOCK_SIZE) {
+        const uint64_t mask = delimiterMask(block);
+        count += size_t(priv_cpu::popcount64(~mask & ((mask << 1) | carry)));
+        carry = mask >> 63;
+      }
+      return count;
+    }
+
+  private:
+    // Bits past the end of s are set, i.e. act as delimiters
+    uint64_t delimiterMask(const size_t block)
+    {
+      if( block != _block ) {
+        const size_t remain = _len - block;
+        _block = block;
+        _mask  = priv_simd::stringMatchSet(_s + block, remain, _set, _setLen);
+        if( remain < BLOCK_SIZE ) {
+          _mask |= ~uint64_t(0) << remain;
+        }
+      }
+      return _mask;
+    }
+
+    const CharT *_s;
+    size_t       _len;
+    const CharT *_set;
+    size_t       _setLen;
+    size_t       _block;
+    uint64_t     _mask;
+  };
+
+  inline csNumberParseResult makeResult(const size_t count, const size_t position,
+                                        const csNumError error)
+  {
+    csNumberParseResult result;
+    result.count    = count;
+    result.position = position;
+    result.error    = error;
+    return result;
+  }
+
+  template<typename CharT, typename T, typename ParseFunc>
+  csNumberParseResult parseRange(const CharT *s, const size_t len,
+                                 const std::basic_string<CharT>& delimiters,
+                                 T *values, const size_t capacity,
+                                 const ParseFunc& func)
+  {
+    Scanner<CharT> scanner(s, len, delimiters);
+
+    size_t count = 0;
+    size_t pos   = scanner.findToken(0);
+    while( pos < len ) {
+      const size_t end = scanner.findDelimiter(pos);
+      if( count >= capacity ) {
+        return makeResult(count, pos, csNumValueTooLarge);
+      }
+
+      const csFromCharsResult<CharT> result = func(s + pos, s + end, values[count]);
+      if( result.error == csNumOutOfRange ) {
+        return makeResult(count, pos, result.error);
+      } else if( result.error != csNumNoError ) {
+        return makeResult(count, size_t(result.ptr - s), result.error);
+      } else if( result.ptr != s + end ) {
+        return makeResult(count, size_t(result.ptr - s), csNumInvalidArgument);
+      }
+
+      count++;
+      pos = scanner.findToken(end);
+    }
+
+    return makeResult(count, len, csNumNoError);
+  }
+
+  struct Chunk {
+    size_t begin;
+    size_t end;
+    size_t count;
+    size_t offset; // of the chunk's first value
+    csNumberParseResult result;
+  };
+
+  // Chunk boundaries are moved forward to the next delimiter
+  template<typename CharT>
+  std::vector<Chunk> splitChunks(const CharT *s, const size_t len,
+                                 const std::basic_string<CharT>& delimiters,
+                                 const size_t numChunks)
+  {
+    Scanner<CharT> scanner(s, len, delimiters);
+
+    std::vector<Chunk> chunks(numChunks);
+    size_t begin = 0;
+    for(size_t i = 0; i < numChunks; i++) {
+      const size_t end = i + 1 < numChunks
+          ? csMax(begin, scanner.findDelimiter((i + 1)*(len/numChunks)))
+          : len;
+      chunks[i].begin  = begin;
+      chunks[i].end    = end;
+      chunks[i].count  = 0;
+      chunks[i].offset = 0;
+      chunks[i].result = makeResult(0, 0, csNumNoError);
+      begin = end;
+    }
+
+    return chunks;
+  }
+
+  template<typename CharT>
+  std::basic_string<CharT> defaultDelimiters()
+  {
+    const char *DELIMITERS = " \t\r\n,;";
+
+    std::basic_string<CharT> result;
+    for(const char *p = DELIMITERS; *p != '\0'; p++) {
+      result.push_back(CharT(*p));
+    }
+
+    return result;
+  }
+
+}; // namespace priv_numberparser
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csNumberParser<CharT>::csNumberParser(const CharT *delimiters)
+  : _delimiters()
+  , _threadCount(1)
+{
+  setDelimiters(delimiters);
+}
+
+template<typename CharT>
+csNumberParser<CharT>::~csNumberParser()
+{
+}
+
+template<typename CharT>
+const std::basic_string<CharT>& csNumberParser<CharT>::delimiters() const
+{
+  return _delimiters;
+}
+
+template<typename CharT>
+void csNumberParser<CharT>::setDelimiters(const CharT *delimiters)
+{
+  _delimiters = delimiters != 0
+      ? std::basic_string<CharT>(delimiters)
+      : priv_numberparser::defaultDelimiters<CharT>();
+}
+
+template<typename CharT>
+int csNumberParser<CharT>::threadCount() const
+{
+  return _threadCount;
+}
+
+template<typename CharT>
+void csNumberParser<CharT>::setThreadCount(const int count)
+{
+  _threadCount = count > 0
+      ? count
+      : csMax<int>(int(std::thread::hardware_concurrency()), 1);
+}
+
+template<typename CharT>
+size_t csNumberParser<CharT>::count(const CharT *first, const CharT *last) const
+{
+  if( first == 0  ||  last <= first ) {
+    return 0;
+  }
+  return priv_numberparser::Scanner<CharT>(first, size_t(last - first), _delimiters).countTokens();
+}
+
+template<typename CharT>
+csNumberParseResult csNumberParser<CharT>::parse(const CharT *first, const CharT *last,
+                                                 int32_t *values, const size_t capacity,
+                                                 const int base) const
+{
+  return parseChunks(first, last, values, capacity,
+                     [base](const CharT *begin, const CharT *end, int32_t& value) -> csFromCharsResult<CharT> {
+    return csFromChars(begin, end, value, base);
+  });
+}
+
+template<typename CharT>
+csNumberParseResult csNumberParser<CharT>::parse(const CharT *first, const CharT *last,
+                                                 uint32_t *values, const size_t capacity,
+                                                 const int base) const
+{
+  return parseChunks(first, last, values, capacity,
+                     [base](const CharT *begin, const CharT *end, uint32_t& value) -> csFromCharsResult<CharT> {
+    return csFromChars(begin, end, value, base);
+  });
+}
+
+template<typename CharT>
+csNumberParseResult csNumberParser<CharT>::parse(const CharT *first, const CharT *last,
+                                                 int64_t *values, const size_t capacity,
+                                                 const int base) const
+{
+  return parseChunks(first, last, values, capacity,
+                     [base](const CharT *begin, const CharT *end, int64_t& value) -> csFromCharsResult<CharT> {
+    return csFromChars(begin, end, value, base);
+  });
+}
+
+template<typename CharT>
+csNumberParseResult csNumberParser<CharT>::parse(const CharT *first, const CharT *last,
+                                                 uint64_t *values, const size_t capacity,
+                                                 const int base) const
+{
+  return parseChunks(first, last, values, capacity,
+                     [base](const CharT *begin, const CharT *end, uint64_t& value) -> csFromCharsResult<CharT> {
+    return csFromChars(begin, end, value, base);
+  });
+}
+
+template<typename CharT>
+csNumberParseResult csNumberParser<CharT>::parse(const CharT *first, const CharT *last,
+                                                 float *values, const size_t capacity) const
+{
+  return parseChunks(first, last, values, capacity,
+                     [](const CharT *begin, const CharT *end, float& value) -> csFromCharsResult<CharT> {
+    return csFromChars(begin, end, value);
+  });
+}
+
+template<typename CharT>
+csNumberParseResult csNumberParser<CharT>::parse(const CharT *first, const CharT *last,
+                                                 double *values, const size_t capacity) const
+{
+  return parseChunks(first, last, values, capacity,
+                     [](const CharT *begin, const CharT *end, double& value) -> csFromCharsResult<CharT> {
+    return csFromChars(begin, end, value);
+  });
+}
+
+template<typename CharT>
+template<typename T, typename ParseFunc>
+csNumberParseResult csNumberParser<CharT>::parseChunks(const CharT *first, const CharT *last,
+                                                       T *values, const size_t capacity,
+                                                       const ParseFunc& func) const
+{
+  using namespace priv_numberparser;
+
+  if( first == 0  ||  last <= first ) {
+    return makeResult(0, 0, csNumNoError);
+  }
+
+  const size_t len       = size_t(last - first);
+  const size_t numChunks = csBound<size_t>(1, len/MIN_CHUNK_SIZE, size_t(_threadCount));
+  if( numChunks < 2 ) {
+    return parseRange(first, len, _delimiters, values, capacity, func);
+  }
+
+  std::vector<Chunk> chunks = splitChunks(first, len, _delimiters, numChunks);
+
+  priv_parallel::run(numChunks, [&](const size_t i) -> void {
+    Chunk& chunk = chunks[i];
+    chunk.count = Scanner<CharT>(first + chunk.begin, chunk.end - chunk.begin, _delimiters).countTokens();
+  });
+
+  size_t total = 0;
+  for(Chunk& chunk : chunks) {
+    chunk.offset = total;
+    total += chunk.count;
+  }
+
+  priv_parallel::run(numChunks, [&](const size_t i) -> void {
+    Chunk& chunk = chunks[i];
+    const bool hasRoom = chunk.offset < capacity;
+    chunk.result = parseRange(first + chunk.begin, chunk.end - chunk.begin, _delimiters,
+                              hasRoom  ?  values + chunk.offset : values,
+                              hasRoom  ?  csMin(chunk.count, capacity - chunk.offset) : 0,
+                              func);
+  });
+
+  // The first chunk in error determines the result
+  for(const Chunk& chunk : chunks) {
+    if( chunk.result.error != csNumNoError ) {
+      return makeResult(chunk.offset + chunk.result.count,
+                        chunk.begin + chunk.result.position,
+                        chunk.result.error);
+    }
+  }
+
+  return makeResult(total, len, csNumNoError);
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csNumberParser<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csNumberParser<wchar_t>;
+#endif
@@ -29,65 +29,139 @@
 ** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *****************************************************************************/
 
+#include <cstring>
+#include <utility>
+
 #include "csCore2/csString.h"
 
 #include "csCore2/csAlphaNum.h"
-#include "csCore2/csChar.h"
-#include "csCore2/csUtil.h"
+
+#include "internal/simd_string.h"
 
 ////// Private ///////////////////////////////////////////////////////////////
 
 namespace priv_string {
 
-  template<typename CharT>
-  bool endsWith(const csBasicString<CharT>& ref, const CharT *s, const size_t len, const bool ignoreCase)
+  // Large enough for 64 binary digits and a sign
+  const size_t NUMBER_SIZE = 65;
+
+  template<typename CharT, typename T>
+  inline csBasicString<CharT> number(const T num, const int base)
   {
-    if( ignoreCase ) {
-      for(size_t i = 0; i < len; i++) {
-        if( csToLower(ref[ref.size()-len+i]) != csToLower(s[i]) ) {
-          return false;
-        }
-      }
-      return true;
+    CharT s[NUMBER_SIZE];
+    const csToCharsResult<CharT> result = csToChars(s, s + NUMBER_SIZE, num, base);
+    if( result.error != csNumNoError ) {
+      return csBasicString<CharT>();
     }
-    for(size_t i = 0; i < len; i++) {
-      if( ref[ref.size()-len+i] != s[i] ) {
-        return false;
-      }
+    return csBasicString<CharT>(csBasicStringView<CharT>(s, size_t(result.ptr - s)));
+  }
+
+  // Like csToUInt(), characters following the number are ignored
+  template<typename T, typename CharT>
+  inline T toNumber(const csBasicStringView<CharT>& s, bool *ok, const int base)
+  {
+    T num = 0;
+    const csFromCharsResult<CharT> result =
+        csFromChars(s.data(), s.data() + s.size(), num, base);
+    if( ok != 0 ) {
+      *ok = result.error == csNumNoError;
     }
-    return true;
+    return result.error == csNumNoError
+        ? num
+        : T(0);
   }
 
+  template<typename CharT, typename T>
+  inline csBasicString<CharT> floatNumber(const T num)
+  {
+    CharT s[NUMBER_SIZE];
+    const csToCharsResult<CharT> result = csToChars(s, s + NUMBER_SIZE, num);
+    if( result.error != csNumNoError ) {
+      return csBasicString<CharT>();
+    }
+    return csBasicString<CharT>(csBasicStringView<CharT>(s, size_t(result.ptr - s)));
+  }
+
+  template<typename T, typename CharT>
+  inline T toFloatingPoint(const csBasicStringView<CharT>& s, bool *ok)
+  {
+    T num = 0;
+    const csFromCharsResult<CharT> result =
+        csFromChars(s.data(), s.data() + s.size(), num);
+    if( ok != 0 ) {
+      *ok = result.error == csNumNoError;
+    }
+    return result.error == csNumNoError
+        ? num
+        : T(0);
+  }
+
+  // Does view refer to characters of s?
   template<typename CharT>
-  bool startsWith(const csBasicString<CharT>& ref, const CharT *s, const size_t len, const bool ignoreCase)
+  inline bool isPartOf(const csBasicStringView<CharT>& view, const std::basic_string<CharT>& s)
   {
-    if( ignoreCase ) {
-      for(size_t i = 0; i < len; i++) {
-        if( csToLower(ref[i]) != csToLower(s[i]) ) {
-          return false;
-        }
-      }
-      return true;
+    return s.data() <= view.data()  &&  view.data() < s.data() + s.size();
+  }
+
+  // Number of non-overlapping occurrences of needle in hay
+  template<typename CharT>
+  inline size_t countMatches(const CharT *hay, const size_t n,
+                             const CharT *needle, const size_t m, const bool ignoreCase)
+  {
+    size_t count = 0;
+    size_t pos   = 0;
+    size_t hit;
+    while( (hit = priv_simd::stringFind(hay + pos, n - pos, needle, m, ignoreCase)) != SIZE_MAX ) {
+      count++;
+      pos += hit + m;
     }
-    for(size_t i = 0; i < len; i++) {
-      if( ref[i] != s[i] ) {
-        return false;
+    return count;
+  }
+
+  // The replacement is not longer than before; compacts s in place, as
+  // written characters never overtake the search.
+  template<typename CharT>
+  inline size_t replaceInPlace(CharT *s, const size_t len,
+                               const csBasicStringView<CharT>& before,
+                               const csBasicStringView<CharT>& after,
+                               const bool ignoreCase)
+  {
+    size_t dest = 0;
+    size_t pos  = 0;
+    size_t hit;
+    while( (hit = priv_simd::stringFind(s + pos, len - pos, before.data(), before.size(), ignoreCase)) != SIZE_MAX ) {
+      if( dest != pos ) {
+        memmove(s + dest, s + pos, hit*sizeof(CharT));
       }
+      dest += hit;
+      memcpy(s + dest, after.data(), after.size()*sizeof(CharT));
+      dest += after.size();
+      pos  += hit + before.size();
     }
-    return true;
+
+    if( dest != pos ) {
+      memmove(s + dest, s + pos, (len - pos)*sizeof(CharT));
+    }
+    return dest + len - pos;
   }
 
+  // Copies s to dest, replacing the first count occurrences of before.
   template<typename CharT>
-  size_t stringLen(const CharT *s)
+  inline void replaceCopy(CharT *dest, const CharT *s, const size_t len,
+                          const csBasicStringView<CharT>& before,
+                          const csBasicStringView<CharT>& after,
+                          const bool ignoreCase, size_t count)
   {
-    if( s == 0 ) {
-      return 0;
-    }
-    size_t len = 0;
-    while( *s++ ) {
-      len++;
+    size_t pos = 0;
+    for(; count > 0; count--) {
+      const size_t hit = priv_simd::stringFind(s + pos, len - pos, before.data(), before.size(), ignoreCase);
+      memcpy(dest, s + pos, hit*sizeof(CharT));
+      dest += hit;
+      memcpy(dest, after.data(), after.size()*sizeof(CharT));
+      dest += after.size();
+      pos  += hit + before.size();
     }
-    return len;
+    memcpy(dest, s + pos, (len - pos)*sizeof(CharT));
   }
 
 }; // namespace priv_string
@@ -106,6 +180,12 @@ csBasicString<CharT>::csBasicString(const csBasicString<CharT>& other)
 {
 }
 
+template<typename CharT>
+csBasicString<CharT>::csBasicString(csBasicString<CharT>&& other) noexcept
+  : std::basic_string<CharT>(std::move(other))
+{
+}
+
 template<typename CharT>
 csBasicString<CharT>::csBasicString(const size_t count, const CharT ch)
   : std::basic_string<CharT>(count, ch)
@@ -124,6 +204,18 @@ csBasicString<CharT>::csBasicString(const std::basic_string<CharT>& other)
 {
 }
 
+template<typename CharT>
+csBasicString<CharT>::csBasicString(std::basic_string<CharT>&& other) noexcept
+  : std::basic_string<CharT>(std::move(other))
+{
+}
+
+template<typename CharT>
+csBasicString<CharT>::csBasicString(const csBasicStringView<CharT>& view)
+  : std::basic_string<CharT>(view.data(), view.size())
+{
+}
+
 template<typename CharT>
 csBasicString<CharT>::~csBasicString()
 {
@@ -138,6 +230,15 @@ csBasicString<CharT>& csBasicString<CharT>::operator=(const csBasicString<CharT>
   return *this;
 }
 
+template<typename CharT>
+csBasicString<CharT>& csBasicString<CharT>::operator=(csBasicString<CharT>&& other) noexcept
+{
+  if( this != &other ) {
+    std::basic_string<CharT>::operator=(std::move(other));
+  }
+  return *this;
+}
+
 template<typename CharT>
 csBasicString<CharT>& csBasicString<CharT>::operator=(const CharT *data)
 {
@@ -152,210 +253,297 @@ csBasicString<CharT>& csBasicString<CharT>::operator=(const std::basic_string<Ch
   return *this;
 }
 
+template<typename CharT>
+csBasicString<CharT>& csBasicString<CharT>::operator=(std::basic_string<CharT>&& other) noexcept
+{
+  std::basic_string<CharT>::operator=(std::move(other));
+  return *this;
+}
+
 template<typename CharT>
 bool csBasicString<CharT>::contains(const CharT ch, const bool ignoreCase) const
 {
   return indexOf(ch, 0, ignoreCase) >= 0;
 }
 
+template<typename CharT>
+bool csBasicString<CharT>::contains(const csBasicStringView<CharT>& needle,
+                                    const bool ignoreCase) const
+{
+  return view().contains(needle, ignoreCase);
+}
+
+template<typename CharT>
+int csBasicString<CharT>::count(const csBasicStringView<CharT>& needle,
+                                const bool ignoreCase) const
+{
+  return view().count(needle, ignoreCase);
+}
+
 template<typename CharT>
 bool csBasicString<CharT>::endsWith(const CharT ch, const bool ignoreCase) const
 {
-  if( empty() ) {
-    return false;
-  }
-  if( ignoreCase ) {
-    return csToLower(operator[](size()-1)) == csToLower(ch);
-  }
-  return operator[](size()-1) == ch;
+  return view().endsWith(ch, ignoreCase);
 }
 
 template<typename CharT>
 bool csBasicString<CharT>::endsWith(const CharT *s, const bool ignoreCase) const
 {
-  if( empty()  ||  priv_string::stringLen(s) < 1  ||
-      priv_string::stringLen(s) > size() ) {
-    return false;
-  }
-  return priv_string::endsWith(*this, s, priv_string::stringLen(s), ignoreCase);
+  return view().endsWith(csBasicStringView<CharT>(s), ignoreCase);
 }
 
 template<typename CharT>
 bool csBasicString<CharT>::endsWith(const csBasicString<CharT>& other,
                                     const bool ignoreCase) const
 {
-  if( empty()  ||  other.empty()  ||  other.size() > size() ) {
-    return false;
-  }
-  return priv_string::endsWith(*this, other.c_str(), other.size(), ignoreCase);
+  return view().endsWith(other.view(), ignoreCase);
 }
 
 template<typename CharT>
 int csBasicString<CharT>::indexOf(const CharT ch, const int from,
                                   const bool ignoreCase) const
 {
-  const int indexFrom = from < 0
-      ? (int)size()+from
-      : from;
-
-  if( empty()  ||  indexFrom < 0  ||  (size_t)indexFrom >= size() ) {
-    return -1;
-  }
-
-  if( ignoreCase ) {
-    const CharT needle = csToLower(ch);
-    for(size_t i = (size_t)indexFrom; i < size(); i++) {
-      if( csToLower(operator[](i)) == needle ) {
-        return (int)i;
-      }
-    }
-  } else {
-    for(size_t i = (size_t)indexFrom; i < size(); i++) {
-      if( operator[](i) == ch ) {
-        return (int)i;
-      }
-    }
-  }
+  return view().indexOf(ch, from, ignoreCase);
+}
 
-  return -1;
+template<typename CharT>
+int csBasicString<CharT>::indexOf(const csBasicStringView<CharT>& needle, const int from,
+                                  const bool ignoreCase) const
+{
+  return view().indexOf(needle, from, ignoreCase);
 }
 
 template<typename CharT>
 int csBasicString<CharT>::lastIndexOf(const CharT ch, const int from,
                                       const bool ignoreCase) const
 {
-  const int indexFrom = from < 0
-      ? (int)size()+from
-      : from;
-
-  if( empty()  ||  indexFrom < 0  ||  (size_t)indexFrom >= size() ) {
-    return -1;
-  }
+  return view().lastIndexOf(ch, from, ignoreCase);
+}
 
-  if( ignoreCase ) {
-    const CharT needle = csToLower(ch);
-    size_t i = (size_t)indexFrom;
-    do {
-      if( csToLower(operator[](i)) == needle ) {
-        return (int)i;
-      }
-    } while( i-- );
-  } else {
-    size_t i = (size_t)indexFrom;
-    do {
-      if( operator[](i) == ch ) {
-        return (int)i;
-      }
-    } while( i-- );
-  }
+template<typename CharT>
+int csBasicString<CharT>::lastIndexOf(const csBasicStringView<CharT>& needle, const int from,
+                                      const bool ignoreCase) const
+{
+  return view().lastIndexOf(needle, from, ignoreCase);
+}
 
-  return -1;
+template<typename CharT>
+csBasicString<CharT> csBasicString<CharT>::mid(const int pos, const int n) const &
+{
+  return csBasicString<CharT>(view().mid(pos, n));
 }
 
 template<typename CharT>
-csBasicString<CharT> csBasicString<CharT>::mid(const int pos, const int n) const
+csBasicString<CharT> csBasicString<CharT>::mid(const int pos, const int n) &&
 {
-  if( empty()  ||  pos < 0  ||  (size_t)pos >= size() ) {
-    csBasicString<CharT>();
+  const csBasicStringView<CharT> sub = view().mid(pos, n);
+  if( sub.empty() ) {
+    return csBasicString<CharT>();
   }
 
-  const size_t len = n < 1
-      ? size() - (size_t)pos
-      : csMin((size_t)n, size() - (size_t)pos);
+  // Reuse this string's buffer
+  const size_t first = size_t(sub.data() - this->data());
+  this->erase(first + sub.size());
+  this->erase(0, first);
+  return std::move(*this);
+}
 
-  csBasicString<CharT> res(len+1);
-  for(size_t i = 0; i < len; i++) {
-    res[i] = operator[]((size_t)pos+i);
-  }
-  return res;
+template<typename CharT>
+csBasicString<CharT> csBasicString<CharT>::number(const int32_t num,
+                                                  const int base)
+{
+  return priv_string::number<CharT>(num, base);
 }
 
 template<typename CharT>
 csBasicString<CharT> csBasicString<CharT>::number(const uint32_t num,
                                                   const int base)
 {
-  const size_t maxsize = 33;
-  CharT s[maxsize];
-  CharT *p = csToStr(s, maxsize, num, base);
-  if( p == 0 ) {
-    return csBasicString<CharT>();
-  }
-  csBasicString<CharT> res(s);
-  return res;
+  return priv_string::number<CharT>(num, base);
+}
+
+template<typename CharT>
+csBasicString<CharT> csBasicString<CharT>::number(const int64_t num,
+                                                  const int base)
+{
+  return priv_string::number<CharT>(num, base);
+}
+
+template<typename CharT>
+csBasicString<CharT> csBasicString<CharT>::number(const uint64_t num,
+                                                  const int base)
+{
+  return priv_string::number<CharT>(num, base);
+}
+
+template<typename CharT>
+csBasicString<CharT> csBasicString<CharT>::number(const float num)
+{
+  return priv_string::floatNumber<CharT>(num);
+}
+
+template<typename CharT>
+csBasicString<CharT> csBasicString<CharT>::number(const double num)
+{
+  return priv_string::floatNumber<CharT>(num);
 }
 
 template<typename CharT>
 csBasicString<CharT>& csBasicString<CharT>::replace(const CharT before,
                                                     const CharT after,
-                                                    const bool ignoreCase)
+                                                    const bool ignoreCase) &
 {
-  if( ignoreCase ) {
-    const CharT needle = csToLower(before);
-    for(size_t i = 0; i < size(); i++) {
-      if( csToLower(operator[](i)) == needle ) {
-        operator[](i) = after;
-      }
-    }
-  } else {
-    for(size_t i = 0; i < size(); i++) {
-      if( operator[](i) == before ) {
-        operator[](i) = after;
-      }
-    }
+  if( !this->empty() ) {
+    priv_simd::stringReplace(&this->operator[](0), this->size(), before, after, ignoreCase);
   }
   return *this;
 }
 
 template<typename CharT>
-bool csBasicString<CharT>::startsWith(const CharT ch, const bool ignoreCase) const
+csBasicString<CharT> csBasicString<CharT>::replace(const CharT before,
+                                                   const CharT after,
+                                                   const bool ignoreCase) &&
 {
-  if( empty() ) {
-    return false;
+  replace(before, after, ignoreCase);
+  return std::move(*this);
+}
+
+template<typename CharT>
+csBasicString<CharT>& csBasicString<CharT>::replaceAll(const csBasicStringView<CharT>& before,
+                                                       const csBasicStringView<CharT>& after,
+                                                       const bool ignoreCase) &
+{
+  if( before.empty()  ||  before.size() > this->size() ) {
+    return *this;
   }
-  if( ignoreCase ) {
-    return csToLower(operator[](0)) == csToLower(ch);
+
+  if( priv_string::isPartOf(before, *this)  ||  priv_string::isPartOf(after, *this) ) {
+    const csBasicString<CharT> beforeCopy(before);
+    const csBasicString<CharT> afterCopy(after);
+    return replaceAll(beforeCopy.view(), afterCopy.view(), ignoreCase);
   }
-  return operator[](0) == ch;
+
+  if( before.size() == 1  &&  after.size() == 1 ) {
+    return replace(before[0], after[0], ignoreCase);
+  }
+
+  if( after.size() <= before.size() ) {
+    this->resize(priv_string::replaceInPlace(&this->operator[](0), this->size(),
+                                             before, after, ignoreCase));
+    return *this;
+  }
+
+  const size_t count = priv_string::countMatches(this->data(), this->size(),
+                                                 before.data(), before.size(), ignoreCase);
+  if( count < 1 ) {
+    return *this;
+  }
+
+  csBasicString<CharT> result(this->size() + count*(after.size() - before.size()));
+  priv_string::replaceCopy(&result[0], this->data(), this->size(),
+                           before, after, ignoreCase, count);
+  std::basic_string<CharT>::swap(result);
+
+  return *this;
+}
+
+template<typename CharT>
+csBasicString<CharT> csBasicString<CharT>::replaceAll(const csBasicStringView<CharT>& before,
+                                                      const csBasicStringView<CharT>& after,
+                                                      const bool ignoreCase) &&
+{
+  replaceAll(before, after, ignoreCase);
+  return std::move(*this);
+}
+
+template<typename CharT>
+csBasicStringSplit<CharT> csBasicString<CharT>::split(const CharT delimiter,
+                                                     const csSplitBehavior behavior) const &
+{
+  return csBasicStringSplit<CharT>(view(), delimiter, behavior);
+}
+
+template<typename CharT>
+csBasicStringSplit<CharT> csBasicString<CharT>::split(const csBasicStringView<CharT>& delimiter,
+                                                     const csSplitBehavior behavior) const &
+{
+  return csBasicStringSplit<CharT>(view(), delimiter, behavior);
+}
+
+template<typename CharT>
+csBasicStringSplit<CharT> csBasicString<CharT>::splitAny(const csBasicStringView<CharT>& delimiters,
+                                                        const csSplitBehavior behavior) const &
+{
+  return csBasicStringSplit<CharT>::anyOf(view(), delimiters, behavior);
+}
+
+template<typename CharT>
+bool csBasicString<CharT>::startsWith(const CharT ch, const bool ignoreCase) const
+{
+  return view().startsWith(ch, ignoreCase);
 }
 
 template<typename CharT>
 bool csBasicString<CharT>::startsWith(const CharT *s, const bool ignoreCase) const
 {
-  if( empty()  ||  priv_string::stringLen(s) < 1  ||
-      priv_string::stringLen(s) > size() ) {
-    return false;
-  }
-  return priv_string::startsWith(*this, s, priv_string::stringLen(s), ignoreCase);
+  return view().startsWith(csBasicStringView<CharT>(s), ignoreCase);
 }
 
 template<typename CharT>
 bool csBasicString<CharT>::startsWith(const csBasicString<CharT>& other,
                                       const bool ignoreCase) const
 {
-  if( empty()  ||  other.empty()  ||  other.size() > size() ) {
-    return false;
-  }
-  return priv_string::startsWith(*this, other.c_str(), other.size(), ignoreCase);
+  return view().startsWith(other.view(), ignoreCase);
+}
+
+template<typename CharT>
+int32_t csBasicString<CharT>::toInt(bool *ok, const int base) const
+{
+  return priv_string::toNumber<int32_t>(view(), ok, base);
 }
 
 template<typename CharT>
 uint32_t csBasicString<CharT>::toUInt(bool *ok, const int base) const
 {
-  if( ok != 0 ) {
-    *ok = false;
-  }
-  if( empty() ) {
-    return 0;
-  }
-  return csToUInt<CharT>(c_str(), ok, base);
+  return priv_string::toNumber<uint32_t>(view(), ok, base);
+}
+
+template<typename CharT>
+int64_t csBasicString<CharT>::toInt64(bool *ok, const int base) const
+{
+  return priv_string::toNumber<int64_t>(view(), ok, base);
+}
+
+template<typename CharT>
+uint64_t csBasicString<CharT>::toUInt64(bool *ok, const int base) const
+{
+  return priv_string::toNumber<uint64_t>(view(), ok, base);
+}
+
+template<typename CharT>
+float csBasicString<CharT>::toFloat(bool *ok) const
+{
+  return priv_string::toFloatingPoint<float>(view(), ok);
+}
+
+template<typename CharT>
+double csBasicString<CharT>::toDouble(bool *ok) const
+{
+  return priv_string::toFloatingPoint<double>(view(), ok);
+}
+
+template<typename CharT>
+csBasicStringView<CharT> csBasicString<CharT>::view() const
+{
+  return csBasicStringView<CharT>(this->data(), this->size());
 }
 
 ////// Instantiation /////////////////////////////////////////////////////////
 
 #ifdef HAVE_CHAR
-template class CS_CORE2_EXPORT csBasicString<char>;
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicString<char>;
 #endif
 
 #ifdef HAVE_WCHAR_T
-template class CS_CORE2_EXPORT csBasicString<wchar_t>;
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicString<wchar_t>;
 #endif
@@ -0,0 +1,383 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <utility>
+
+#include "csCore2/csStringBuilder.h"
+
+#include "csCore2/csUtil.h"
+
+#include "internal/simd_string.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_stringbuilder {
+
+  const size_t MIN_CAPACITY = 32;
+
+  // Large enough for 64 binary digits and a sign
+  const size_t NUMBER_SIZE = 65;
+
+  template<typename CharT>
+  inline const CharT *emptyString()
+  {
+    static const CharT empty = CharT(0);
+    return &empty;
+  }
+
+}; // namespace priv_stringbuilder
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csBasicStringBuilder<CharT>::csBasicStringBuilder()
+  : _data(0)
+  , _size(0)
+  , _capacity(0)
+  , _inline(0)
+  , _inlineCapacity(0)
+  , _heap()
+{
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>::csBasicStringBuilder(const size_t capacity)
+  : csBasicStringBuilder<CharT>()
+{
+  reserve(capacity);
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>::csBasicStringBuilder(CharT *buffer, const size_t size)
+  : csBasicStringBuilder<CharT>()
+{
+  if( buffer != 0  &&  size > 0 ) {
+    _inline         = buffer;
+    _inlineCapacity = size - 1;
+  }
+  reset();
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>::csBasicStringBuilder(csBasicStringBuilder<CharT>&& other) noexcept
+  : csBasicStringBuilder<CharT>()
+{
+  operator=(std::move(other));
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>::~csBasicStringBuilder()
+{
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::operator=(csBasicStringBuilder<CharT>&& other) noexcept
+{
+  if( this != &other ) {
+    const bool isHeap = other._data != 0  &&  other._data != other._inline;
+
+    _heap           = std::move(other._heap);
+    _data           = isHeap
+        ? &_heap[0]
+        : other._data;
+    _size           = other._size;
+    _capacity       = other._capacity;
+    _inline         = other._inline;
+    _inlineCapacity = other._inlineCapacity;
+
+    // The inline buffer now belongs to this builder
+    other._heap.clear();
+    other._inline         = 0;
+    other._inlineCapacity = 0;
+    other.reset();
+  }
+  return *this;
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::append(const CharT ch)
+{
+  CharT *p = makeRoom(1);
+  p[0] = ch;
+  p[1] = CharT(0);
+  _size++;
+  return *this;
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::append(const size_t count,
+                                                                 const CharT ch)
+{
+  if( count < 1 ) {
+    return *this;
+  }
+  CharT *p = makeRoom(count);
+  std::char_traits<CharT>::assign(p, count, ch);
+  p[count] = CharT(0);
+  _size += count;
+  return *this;
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::append(const CharT *s)
+{
+  if( s == 0 ) {
+    return *this;
+  }
+  return append(s, priv_simd::stringLen(s));
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::append(const CharT *s,
+                                                                 const size_t count)
+{
+  if( s == 0  ||  count < 1 ) {
+    return *this;
+  }
+  // s may point into our own storage, which makeRoom() might reallocate
+  if( _data != 0  &&  _data <= s  &&  s < _data + _size ) {
+    const size_t offset = size_t(s - _data);
+    CharT *p = makeRoom(count);
+    std::char_traits<CharT>::copy(p, _data + offset, count);
+    p[count] = CharT(0);
+  } else {
+    CharT *p = makeRoom(count);
+    std::char_traits<CharT>::copy(p, s, count);
+    p[count] = CharT(0);
+  }
+  _size += count;
+  return *this;
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::append(const csBasicString<CharT>& s)
+{
+  return append(s.data(), s.size());
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::append(const csBasicStringView<CharT>& s)
+{
+  return append(s.data(), s.size());
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::appendNumber(const int32_t num,
+                                                                       const int base)
+{
+  CharT number[priv_stringbuilder::NUMBER_SIZE];
+  CharT *p = numberBuffer(number);
+  return commit(p, csToChars(p, p + priv_stringbuilder::NUMBER_SIZE, num, base));
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::appendNumber(const uint32_t num,
+                                                                       const int base)
+{
+  CharT number[priv_stringbuilder::NUMBER_SIZE];
+  CharT *p = numberBuffer(number);
+  return commit(p, csToChars(p, p + priv_stringbuilder::NUMBER_SIZE, num, base));
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::appendNumber(const int64_t num,
+                                                                       const int base)
+{
+  CharT number[priv_stringbuilder::NUMBER_SIZE];
+  CharT *p = numberBuffer(number);
+  return commit(p, csToChars(p, p + priv_stringbuilder::NUMBER_SIZE, num, base));
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::appendNumber(const uint64_t num,
+                                                                       const int base)
+{
+  CharT number[priv_stringbuilder::NUMBER_SIZE];
+  CharT *p = numberBuffer(number);
+  return commit(p, csToChars(p, p + priv_stringbuilder::NUMBER_SIZE, num, base));
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::appendNumber(const float num)
+{
+  CharT number[priv_stringbuilder::NUMBER_SIZE];
+  CharT *p = numberBuffer(number);
+  return commit(p, csToChars(p, p + priv_stringbuilder::NUMBER_SIZE, num));
+}
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::appendNumber(const double num)
+{
+  CharT number[priv_stringbuilder::NUMBER_SIZE];
+  CharT *p = numberBuffer(number);
+  return commit(p, csToChars(p, p + priv_stringbuilder::NUMBER_SIZE, num));
+}
+
+template<typename CharT>
+const CharT *csBasicStringBuilder<CharT>::c_str() const
+{
+  return _data != 0
+      ? _data
+      : priv_stringbuilder::emptyString<CharT>();
+}
+
+template<typename CharT>
+size_t csBasicStringBuilder<CharT>::capacity() const
+{
+  return _capacity;
+}
+
+template<typename CharT>
+void csBasicStringBuilder<CharT>::clear()
+{
+  _size = 0;
+  if( _data != 0 ) {
+    _data[0] = CharT(0);
+  }
+}
+
+template<typename CharT>
+bool csBasicStringBuilder<CharT>::empty() const
+{
+  return _size == 0;
+}
+
+template<typename CharT>
+void csBasicStringBuilder<CharT>::reserve(const size_t capacity)
+{
+  if( capacity > _capacity ) {
+    reallocate(capacity);
+  }
+}
+
+template<typename CharT>
+size_t csBasicStringBuilder<CharT>::size() const
+{
+  return _size;
+}
+
+template<typename CharT>
+csBasicStringView<CharT> csBasicStringBuilder<CharT>::view() const
+{
+  return csBasicStringView<CharT>(c_str(), _size);
+}
+
+template<typename CharT>
+csBasicString<CharT> csBasicStringBuilder<CharT>::take()
+{
+  csBasicString<CharT> result;
+  if( _data != 0  &&  _data != _inline ) {
+    _heap.resize(_size);
+    result = std::move(_heap);
+    _heap.clear();
+  } else if( _size > 0 ) {
+    result = csBasicString<CharT>(view());
+  }
+  reset();
+  return result;
+}
+
+////// Private ///////////////////////////////////////////////////////////////
+
+template<typename CharT>
+csBasicStringBuilder<CharT>& csBasicStringBuilder<CharT>::commit(const CharT *first,
+                                                                 const csToCharsResult<CharT>& result)
+{
+  if( result.error != csNumNoError ) {
+    return *this;
+  }
+  if( first != _data + _size ) {
+    return append(first, size_t(result.ptr - first));
+  }
+  _size = size_t(result.ptr - _data);
+  _data[_size] = CharT(0);
+  return *this;
+}
+
+template<typename CharT>
+inline CharT *csBasicStringBuilder<CharT>::makeRoom(const size_t count)
+{
+  if( _capacity - _size < count ) {
+    reallocate(csMax(_size + count,
+                     csMax(2*_capacity, priv_stringbuilder::MIN_CAPACITY)));
+  }
+  return _data + _size;
+}
+
+// Formats in place if there is room, otherwise into number, so that a
+// short number does not spill the caller-provided buffer needlessly
+template<typename CharT>
+inline CharT *csBasicStringBuilder<CharT>::numberBuffer(CharT *number)
+{
+  return _capacity - _size >= priv_stringbuilder::NUMBER_SIZE
+      ? _data + _size
+      : number;
+}
+
+template<typename CharT>
+void csBasicStringBuilder<CharT>::reallocate(const size_t capacity)
+{
+  if( _data != 0  &&  _data != _inline ) {
+    // Only the used part is copied
+    _heap.resize(_size);
+    _heap.resize(capacity);
+  } else {
+    _heap.clear();
+    _heap.resize(capacity);
+    if( _size > 0 ) {
+      std::char_traits<CharT>::copy(&_heap[0], _data, _size);
+    }
+  }
+  _data     = &_heap[0];
+  _capacity = capacity;
+  _data[_size] = CharT(0);
+}
+
+template<typename CharT>
+void csBasicStringBuilder<CharT>::reset()
+{
+  _data     = _inline;
+  _size     = 0;
+  _capacity = _inlineCapacity;
+  if( _data != 0 ) {
+    _data[0] = CharT(0);
+  }
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringBuilder<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringBuilder<wchar_t>;
+#endif
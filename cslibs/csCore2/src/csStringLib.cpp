@@ -29,10 +29,49 @@
 ** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *****************************************************************************/
 
+#include <cstring>
+
 #include "csCore2/csStringLib.h"
 
 #include "csCore2/csChar.h"
-#include "csCore2/csUtil.h"
+
+#include "internal/simd_string.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_stringlib {
+
+  // Single pass; null is treated like the empty string.
+  template<typename CharT>
+  int compare(const CharT *s1, const CharT *s2, const size_t maxsize, const bool ignoreCase)
+  {
+    const CharT empty = CharT(0);
+    if( s1 == 0 ) {
+      s1 = &empty;
+    }
+    if( s2 == 0 ) {
+      s2 = &empty;
+    }
+
+    const size_t i = priv_simd::stringMismatch(s1, s2, maxsize, ignoreCase);
+    if( i >= maxsize ) {
+      return 0;
+    }
+
+    if(        s1[i] == CharT(0)  &&  s2[i] == CharT(0) ) {
+      return 0;
+    } else if( s1[i] == CharT(0) ) { // len1 < len2
+      return -1;
+    } else if( s2[i] == CharT(0) ) { // len1 > len2
+      return 1;
+    }
+
+    return ignoreCase
+        ? int(csToLower(s1[i]))-int(csToLower(s2[i]))
+        : int(s1[i])-int(s2[i]);
+  }
+
+}; // namespace priv_stringlib
 
 ////// Implementation ////////////////////////////////////////////////////////
 
@@ -45,71 +84,20 @@ CharT *csStringCat(CharT *dest, const CharT *src)
   if( src == 0 ) {
     return dest;
   }
-  const size_t N = csStringLen(src);
-  CharT *to = &dest[csStringLen(dest)];
-  for(size_t i = 0; i < N; i++) {
-    *to++ = *src++;
-  }
-  *to = CharT(0);
+  csStringPCpy(&dest[priv_simd::stringLen(dest)], src);
   return dest;
 }
 
 template<typename CharT>
 int csStringCmp(const CharT *s1, const CharT *s2)
 {
-  const size_t len1 = csStringLen(s1);
-  const size_t len2 = csStringLen(s2);
-  if( len1 < 1  ||  len2 < 1 ) {
-    if(        len1 < 1  &&  len2 < 1 ) {
-      return 0;
-    } else if( len1 < 1 ) {
-      return -1;
-    } else if( len2 < 1 ) {
-      return 1;
-    }
-  }
-  const size_t len = csMin(len1, len2);
-  for(size_t i = 0; i < len; i++) {
-    const int diff = int(s1[i])-int(s2[i]);
-    if( diff != 0 ) {
-      return diff;
-    }
-  }
-  if(        len1 < len2 ) {
-    return -1;
-  } else if( len1 > len2 ) {
-    return 1;
-  }
-  return 0;
+  return priv_stringlib::compare(s1, s2, SIZE_MAX, false);
 }
 
 template<typename CharT>
 int csStringCmpI(const CharT *s1, const CharT *s2)
 {
-  const size_t len1 = csStringLen(s1);
-  const size_t len2 = csStringLen(s2);
-  if( len1 < 1  ||  len2 < 1 ) {
-    if(        len1 < 1  &&  len2 < 1 ) {
-      return 0;
-    } else if( len1 < 1 ) {
-      return -1;
-    } else if( len2 < 1 ) {
-      return 1;
-    }
-  }
-  const size_t len = csMin(len1, len2);
-  for(size_t i = 0; i < len; i++) {
-    const int diff = int(csToLower(s1[i]))-int(csToLower(s2[i]));
-    if( diff != 0 ) {
-      return diff;
-    }
-  }
-  if(        len1 < len2 ) {
-    return -1;
-  } else if( len1 > len2 ) {
-    return 1;
-  }
-  return 0;
+  return priv_stringlib::compare(s1, s2, SIZE_MAX, true);
 }
 
 template<typename CharT>
@@ -121,12 +109,7 @@ CharT *csStringCpy(CharT *dest, const CharT *src)
   if( src == 0 ) {
     return dest;
   }
-  const size_t N = csStringLen(src);
-  CharT *to = dest;
-  for(size_t i = 0; i < N; i++) {
-    *to++ = *src++;
-  }
-  *to = CharT(0);
+  csStringPCpy(dest, src);
   return dest;
 }
 
@@ -136,11 +119,7 @@ size_t csStringLen(const CharT *s)
   if( s == 0 ) {
     return 0;
   }
-  size_t size = 0;
-  while( *s++ != CharT(0) ) {
-    size++;
-  }
-  return size;
+  return priv_simd::stringLen(s);
 }
 
 template<typename CharT>
@@ -152,11 +131,10 @@ CharT *csStringNCat(CharT *dest, const CharT *src, const size_t maxsize)
   if( src == 0 ) {
     return dest;
   }
-  CharT *to = &dest[csStringLen(dest)];
-  for(size_t i = 0; i < maxsize  &&  *src != CharT(0); i++) {
-    *to++ = *src++;
-  }
-  *to = CharT(0);
+  CharT *to = &dest[priv_simd::stringLen(dest)];
+  const size_t N = priv_simd::stringNLen(src, maxsize);
+  memcpy(to, src, N*sizeof(CharT));
+  to[N] = CharT(0);
   return dest;
 }
 
@@ -172,21 +150,7 @@ int csStringNCmp(const CharT *s1, const CharT *s2, const size_t maxsize)
       return 1;
     }
   }
-  size_t i;
-  for(i = 0; i < maxsize  &&  s1[i] != CharT(0)  &&  s2[i] != CharT(0); i++) {
-    const int diff = int(s1[i])-int(s2[i]);
-    if( diff != 0 ) {
-      return diff;
-    }
-  }
-  if( i < maxsize ) {
-    if(        s1[i] == CharT(0)  &&  s2[i] != CharT(0) ) { // len1 < len2
-      return -1;
-    } else if( s1[i] != CharT(0)  &&  s2[i] == CharT(0) ) { // len1 > len2
-      return 1;
-    }
-  }
-  return 0;
+  return priv_stringlib::compare(s1, s2, maxsize, false);
 }
 
 template<typename CharT>
@@ -201,21 +165,7 @@ int csStringNCmpI(const CharT *s1, const CharT *s2, const size_t maxsize)
       return 1;
     }
   }
-  size_t i;
-  for(i = 0; i < maxsize  &&  s1[i] != CharT(0)  &&  s2[i] != CharT(0); i++) {
-    const int diff = int(csToLower(s1[i]))-int(csToLower(s2[i]));
-    if( diff != 0 ) {
-      return diff;
-    }
-  }
-  if( i < maxsize ) {
-    if(        s1[i] == CharT(0)  &&  s2[i] != CharT(0) ) { // len1 < len2
-      return -1;
-    } else if( s1[i] != CharT(0)  &&  s2[i] == CharT(0) ) { // len1 > len2
-      return 1;
-    }
-  }
-  return 0;
+  return priv_stringlib::compare(s1, s2, maxsize, true);
 }
 
 template<typename CharT>
@@ -227,14 +177,9 @@ CharT *csStringNCpy(CharT *dest, const CharT *src, const size_t maxsize)
   if( src == 0 ) {
     return dest;
   }
-  CharT *to = dest;
-  size_t i;
-  for(i = 0; i < maxsize  &&  *src != CharT(0); i++) {
-    *to++ = *src++;
-  }
-  for(size_t fill = i; fill < maxsize; fill++) {
-    *to++ = CharT(0);
-  }
+  const size_t N = priv_simd::stringNLen(src, maxsize);
+  memcpy(dest, src, N*sizeof(CharT));
+  memset(&dest[N], 0, (maxsize - N)*sizeof(CharT));
   return dest;
 }
 
@@ -244,11 +189,22 @@ size_t csStringNLen(const CharT *s, const size_t maxsize)
   if( s == 0  ||  maxsize < 1 ) {
     return 0;
   }
-  size_t size = 0;
-  while( size < maxsize  &&  *s++ != CharT(0) ) {
-    size++;
+  return priv_simd::stringNLen(s, maxsize);
+}
+
+template<typename CharT>
+CharT *csStringPCpy(CharT *dest, const CharT *src)
+{
+  if( dest == 0 ) {
+    return 0;
+  }
+  if( src == 0 ) {
+    *dest = CharT(0);
+    return dest;
   }
-  return size;
+  const size_t N = priv_simd::stringLen(src);
+  memcpy(dest, src, (N + 1)*sizeof(CharT));
+  return &dest[N];
 }
 
 ////// Explicit instantiation ////////////////////////////////////////////////
@@ -264,6 +220,7 @@ template CS_CORE2_EXPORT int csStringNCmp<char>(const char *s1, const char *s2,
 template CS_CORE2_EXPORT int csStringNCmpI<char>(const char *s1, const char *s2, const size_t maxsize);
 template CS_CORE2_EXPORT char *csStringNCpy<char>(char *dest, const char *src, const size_t maxsize);
 template CS_CORE2_EXPORT size_t csStringNLen<char>(const char *s, const size_t maxsize);
+template CS_CORE2_EXPORT char *csStringPCpy<char>(char *dest, const char *src);
 #endif
 
 #ifdef HAVE_WCHAR_T
@@ -277,4 +234,5 @@ template CS_CORE2_EXPORT int csStringNCmp<wchar_t>(const wchar_t *s1, const wcha
 template CS_CORE2_EXPORT int csStringNCmpI<wchar_t>(const wchar_t *s1, const wchar_t *s2, const size_t maxsize);
 template CS_CORE2_EXPORT wchar_t *csStringNCpy<wchar_t>(wchar_t *dest, const wchar_t *src, const size_t maxsize);
 template CS_CORE2_EXPORT size_t csStringNLen<wchar_t>(const wchar_t *s, const size_t maxsize);
+template CS_CORE2_EXPORT wchar_t *csStringPCpy<wchar_t>(wchar_t *dest, const wchar_t *src);
 #endif
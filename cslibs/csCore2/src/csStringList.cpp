@@ -29,6 +29,8 @@
 ** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *****************************************************************************/
 
+#include <utility>
+
 #include "csCore2/csStringList.h"
 
 ////// Implementation ////////////////////////////////////////////////////////
@@ -45,6 +47,13 @@ csBasicStringList<StringT>::csBasicStringList(const csBasicStringList<StringT>&
 {
 }
 
+template<class StringT>
+csBasicStringList<StringT>::csBasicStringList(csBasicStringList<StringT>&& other)
+  noexcept(std::is_nothrow_move_constructible<std::list<StringT>>::value)
+  : std::list<StringT>(std::move(other))
+{
+}
+
 template<class StringT>
 csBasicStringList<StringT>::~csBasicStringList()
 {
@@ -59,12 +68,22 @@ csBasicStringList<StringT>& csBasicStringList<StringT>::operator=(const csBasicS
   return *this;
 }
 
+template<class StringT>
+csBasicStringList<StringT>& csBasicStringList<StringT>::operator=(csBasicStringList<StringT>&& other)
+  noexcept(std::is_nothrow_move_assignable<std::list<StringT>>::value)
+{
+  if( this != &other ) {
+    std::list<StringT>::operator=(std::move(other));
+  }
+  return *this;
+}
+
 ////// Explicit instantiation ////////////////////////////////////////////////
 
 #ifdef HAVE_CHAR
-template class CS_CORE2_EXPORT csBasicStringList<csString>;
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringList<csString>;
 #endif
 
 #ifdef HAVE_WCHAR_T
-template class CS_CORE2_EXPORT csBasicStringList<csWString>;
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringList<csWString>;
 #endif
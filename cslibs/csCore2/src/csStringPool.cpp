@@ -0,0 +1,335 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "csCore2/csStringPool.h"
+
+#include "csCore2/csHash.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_stringpool {
+
+  // Strings are copied into chunks of this size...
+  const size_t CHUNK_SIZE = 64*1024;
+  // ...unless they exceed this size
+  const size_t MAX_CHUNKED_SIZE = CHUNK_SIZE/4;
+
+  const int MAX_SHARD_BITS = 6;
+
+  const size_t MIN_SLOTS = 64;
+
+  inline int shardBits(int numShards)
+  {
+    if( numShards < 1 ) {
+      numShards = int(std::thread::hardware_concurrency());
+    }
+
+    int bits = 0;
+    while( bits < MAX_SHARD_BITS  &&  (1 << bits) < numShards ) {
+      bits++;
+    }
+
+    return bits;
+  }
+
+}; // namespace priv_stringpool
+
+template<typename CharT>
+struct csStringPool<CharT>::Shard {
+  struct Entry {
+    const CharT *data;
+    size_t size;
+    uint32_t hash;
+  };
+
+  Shard()
+    : chunkPos(0)
+    , chunkFree(0)
+    , arenaBytes(0)
+    , numChars(0)
+  {
+  }
+
+  void clear()
+  {
+    chunks.clear();
+    chunkPos   = 0;
+    chunkFree  = 0;
+    arenaBytes = 0;
+    numChars   = 0;
+    entries.clear();
+    slots.clear();
+  }
+
+  // Returns the index of the entry + 1; 0 if s was not found.
+  uint32_t find(const CharT *s, const size_t len, const uint64_t h) const
+  {
+    if( slots.empty() ) {
+      return 0;
+    }
+
+    const size_t mask = slots.size() - 1;
+    for(size_t pos = size_t(h) & mask; slots[pos] != 0; pos = (pos + 1) & mask) {
+      const Entry& e = entries[slots[pos] - 1];
+      if( e.hash == uint32_t(h)  &&  e.size == len  &&
+          std::char_traits<CharT>::compare(e.data, s, len) == 0 ) {
+        return slots[pos];
+      }
+    }
+
+    return 0;
+  }
+
+  // Returns the index of the new entry + 1.
+  uint32_t insert(const CharT *s, const size_t len, const uint64_t h)
+  {
+    if( (entries.size() + 1)*2 > slots.size() ) {
+      rehash(std::max(priv_stringpool::MIN_SLOTS, slots.size()*2));
+    }
+
+    CharT *data = allocate(len + 1);
+    std::char_traits<CharT>::copy(data, s, len);
+    data[len] = CharT(0);
+    numChars += len + 1;
+
+    const Entry e = { data, len, uint32_t(h) };
+    entries.push_back(e);
+
+    const size_t mask = slots.size() - 1;
+    size_t pos = size_t(h) & mask;
+    while( slots[pos] != 0 ) {
+      pos = (pos + 1) & mask;
+    }
+    slots[pos] = uint32_t(entries.size());
+
+    return slots[pos];
+  }
+
+  CharT *allocate(const size_t count)
+  {
+    using namespace priv_stringpool;
+
+    if( count*sizeof(CharT) > MAX_CHUNKED_SIZE ) {
+      // NOTE: The current chunk remains in use.
+      chunks.emplace_back(new CharT[count]);
+      arenaBytes += count*sizeof(CharT);
+      return chunks.back().get();
+    }
+
+    if( count > chunkFree ) {
+      const size_t chunkCount = CHUNK_SIZE/sizeof(CharT);
+      chunks.emplace_back(new CharT[chunkCount]);
+      arenaBytes += CHUNK_SIZE;
+      chunkPos  = chunks.back().get();
+      chunkFree = chunkCount;
+    }
+
+    CharT *result = chunkPos;
+    chunkPos  += count;
+    chunkFree -= count;
+
+    return result;
+  }
+
+  void rehash(const size_t numSlots)
+  {
+    slots.assign(numSlots, 0);
+
+    const size_t mask = numSlots - 1;
+    for(size_t i = 0; i < entries.size(); i++) {
+      size_t pos = entries[i].hash & mask;
+      while( slots[pos] != 0 ) {
+        pos = (pos + 1) & mask;
+      }
+      slots[pos] = uint32_t(i + 1);
+    }
+  }
+
+  mutable std::shared_mutex mutex;
+  std::vector<std::unique_ptr<CharT[]>> chunks;
+  CharT *chunkPos;
+  size_t chunkFree;
+  size_t arenaBytes;
+  size_t numChars;
+  std::vector<Entry> entries;
+  std::vector<uint32_t> slots; // index of the entry + 1; 0 if empty
+};
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csStringPool<CharT>::csStringPool(const int numShards)
+  : _shards()
+  , _shardBits(priv_stringpool::shardBits(numShards))
+{
+  _shards.reset(new Shard[size_t(1) << _shardBits]);
+}
+
+template<typename CharT>
+csStringPool<CharT>::~csStringPool()
+{
+}
+
+template<typename CharT>
+void csStringPool<CharT>::clear()
+{
+  for(int i = 0; i < numShards(); i++) {
+    const std::unique_lock<std::shared_mutex> lock(_shards[i].mutex);
+    _shards[i].clear();
+  }
+}
+
+template<typename CharT>
+csStringHandle csStringPool<CharT>::find(const csBasicStringView<CharT>& s) const
+{
+  const uint64_t h   = csHash(s.data(), s.size());
+  const size_t shard = _shardBits > 0
+      ? size_t(h >> (64 - _shardBits))
+      : 0;
+
+  const std::shared_lock<std::shared_mutex> lock(_shards[shard].mutex);
+  const uint32_t index = _shards[shard].find(s.data(), s.size(), h);
+
+  return index != 0
+      ? csStringHandle((index << _shardBits) | shard)
+      : csInvalidStringHandle;
+}
+
+template<typename CharT>
+csStringHandle csStringPool<CharT>::insert(const csBasicStringView<CharT>& s)
+{
+  const uint64_t h   = csHash(s.data(), s.size());
+  const size_t shard = _shardBits > 0
+      ? size_t(h >> (64 - _shardBits))
+      : 0;
+
+  // Most strings are inserted repeatedly; look up without blocking readers
+  {
+    const std::shared_lock<std::shared_mutex> lock(_shards[shard].mutex);
+    const uint32_t index = _shards[shard].find(s.data(), s.size(), h);
+    if( index != 0 ) {
+      return csStringHandle((index << _shardBits) | shard);
+    }
+  }
+
+  const std::unique_lock<std::shared_mutex> lock(_shards[shard].mutex);
+  uint32_t index = _shards[shard].find(s.data(), s.size(), h);
+  if( index == 0 ) {
+    if( _shards[shard].entries.size() >= size_t(UINT32_MAX >> _shardBits) ) {
+      return csInvalidStringHandle;
+    }
+    index = _shards[shard].insert(s.data(), s.size(), h);
+  }
+
+  return csStringHandle((index << _shardBits) | shard);
+}
+
+template<typename CharT>
+int csStringPool<CharT>::numShards() const
+{
+  return 1 << _shardBits;
+}
+
+template<typename CharT>
+size_t csStringPool<CharT>::size() const
+{
+  size_t result = 0;
+  for(int i = 0; i < numShards(); i++) {
+    const std::shared_lock<std::shared_mutex> lock(_shards[i].mutex);
+    result += _shards[i].entries.size();
+  }
+  return result;
+}
+
+template<typename CharT>
+csStringPoolStatistics csStringPool<CharT>::statistics() const
+{
+  csStringPoolStatistics result;
+  result.numStrings = 0;
+  result.numChars   = 0;
+  result.arenaBytes = 0;
+  result.indexBytes = 0;
+
+  for(int i = 0; i < numShards(); i++) {
+    const Shard& shard = _shards[i];
+
+    const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    result.numStrings += shard.entries.size();
+    result.numChars   += shard.numChars;
+    result.arenaBytes += shard.arenaBytes;
+    result.indexBytes +=
+        shard.entries.capacity()*sizeof(typename Shard::Entry) +
+        shard.slots.capacity()*sizeof(uint32_t) +
+        shard.chunks.capacity()*sizeof(std::unique_ptr<CharT[]>);
+  }
+
+  return result;
+}
+
+template<typename CharT>
+const CharT *csStringPool<CharT>::c_str(const csStringHandle h) const
+{
+  return value(h).data();
+}
+
+template<typename CharT>
+csBasicStringView<CharT> csStringPool<CharT>::value(const csStringHandle h) const
+{
+  static const CharT EMPTY = CharT(0);
+
+  const size_t shard = size_t(h) & ((size_t(1) << _shardBits) - 1);
+  const size_t index = size_t(h >> _shardBits);
+
+  const std::shared_lock<std::shared_mutex> lock(_shards[shard].mutex);
+  if( index < 1  ||  index > _shards[shard].entries.size() ) {
+    return csBasicStringView<CharT>(&EMPTY, 0);
+  }
+
+  const typename Shard::Entry& e = _shards[shard].entries[index - 1];
+  return csBasicStringView<CharT>(e.data, e.size);
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csStringPool<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csStringPool<wchar_t>;
+#endif
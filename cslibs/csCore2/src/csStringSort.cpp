@@ -0,0 +1,316 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "csCore2/csStringSort.h"
+
+#include "internal/parallel.h"
+#include "internal/simd_string.h"
+#include "internal/stringsort.h"
+
+#include "csCore2/csChar.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_stringsort {
+
+  // Smaller ranges are sorted by insertion
+  const size_t INSERTION_SORT_SIZE = 16;
+
+  // Smaller ranges are sorted by the task partitioning them
+  const size_t MIN_TASK_SIZE = 32*1024;
+
+  // A key packs the characters at [depth,depth+NUM_UNITS) into one integer,
+  // ordered like csStringCmp() orders them:
+  // - the characters are mapped by csToLower() when ignoring case,
+  // - signed characters are biased to compare as unsigned values,
+  // - units past the end of the string are zero and below any character.
+  template<typename CharT>
+  struct Key {
+    typedef typename std::make_unsigned<CharT>::type UnitT;
+
+    static constexpr int    UNIT_BITS = int(8*sizeof(CharT));
+    static constexpr int    NUM_UNITS = 64/UNIT_BITS;
+    static constexpr UnitT  BIAS      = std::is_signed<CharT>::value
+        ? UnitT(UnitT(1) << (UNIT_BITS - 1))
+        : UnitT(0);
+
+    static uint64_t unit(const CharT ch, const bool ignoreCase)
+    {
+      const UnitT u = UnitT(UnitT(ignoreCase ? csToLower(ch) : ch) ^ BIAS);
+      // NOTE: NUL is never present; shifting the values below it fills its gap.
+      return u < BIAS
+          ? uint64_t(u) + 1
+          : uint64_t(u);
+    }
+
+    static uint64_t load(const CharT *s, const size_t len, const size_t depth,
+                         const bool ignoreCase)
+    {
+      uint64_t key = 0;
+      for(size_t i = depth; i < depth + NUM_UNITS; i++) {
+        key <<= UNIT_BITS;
+        if( i < len ) {
+          key |= unit(s[i], ignoreCase);
+        }
+      }
+      return key;
+    }
+
+    // Does the key reach past the string's end?
+    static bool isFinal(const uint64_t key)
+    {
+      return (key & ((uint64_t(1) << UNIT_BITS) - 1)) == 0;
+    }
+  };
+
+  template<typename CharT>
+  inline void loadKeys(Item<CharT> *items, const size_t numItems, const size_t depth,
+                       const bool ignoreCase)
+  {
+    for(size_t i = 0; i < numItems; i++) {
+      items[i].key = Key<CharT>::load(items[i].s, items[i].len, depth, ignoreCase);
+    }
+  }
+
+  // Compares the strings' suffixes from depth on, like csStringCmp()
+  template<typename CharT>
+  inline int compareFrom(const Item<CharT>& a, const Item<CharT>& b, const size_t depth,
+                         const bool ignoreCase)
+  {
+    const size_t len = std::min(a.len, b.len);
+
+    const size_t i = depth < len
+        ? depth + priv_simd::stringMismatch(a.s + depth, b.s + depth, len - depth, ignoreCase)
+        : len;
+    if( i >= len ) {
+      return a.len < b.len
+          ? -1
+          : a.len > b.len ? 1 : 0;
+    }
+
+    const int ch1 = ignoreCase
+        ? int(csToLower(a.s[i]))
+        : int(a.s[i]);
+    const int ch2 = ignoreCase
+        ? int(csToLower(b.s[i]))
+        : int(b.s[i]);
+
+    return ch1 < ch2
+        ? -1
+        : 1;
+  }
+
+  // Requires the keys loaded at depth
+  template<typename CharT>
+  void insertionSort(Item<CharT> *items, const size_t numItems, const size_t depth,
+                     const bool ignoreCase)
+  {
+    const auto isLess = [=](const Item<CharT>& a, const Item<CharT>& b) -> bool {
+      if( a.key != b.key ) {
+        return a.key < b.key;
+      }
+      return !Key<CharT>::isFinal(a.key)  &&
+          compareFrom(a, b, depth + Key<CharT>::NUM_UNITS, ignoreCase) < 0;
+    };
+
+    for(size_t i = 1; i < numItems; i++) {
+      Item<CharT> item = items[i];
+      size_t j = i;
+      for(; j > 0  &&  isLess(item, items[j - 1]); j--) {
+        items[j] = items[j - 1];
+      }
+      items[j] = item;
+    }
+  }
+
+  inline uint64_t medianOf3(const uint64_t a, const uint64_t b, const uint64_t c)
+  {
+    return a < b
+        ? (b < c ? b : (a < c ? c : a))
+        : (a < c ? a : (b < c ? c : b));
+  }
+
+  // Multikey quicksort; requires the keys loaded at depth. If a queue is
+  // given, large partitions are pushed to it as new tasks.
+  template<typename CharT>
+  void sortRange(Item<CharT> *items, size_t numItems, size_t depth, const bool ignoreCase,
+                 priv_parallel::TaskQueue *queue)
+  {
+    const auto sortPart = [=](Item<CharT> *part, const size_t numPart,
+                              const size_t depth) -> void {
+      if( numPart < 2 ) {
+        return;
+      } else if( queue != 0  &&  numPart >= MIN_TASK_SIZE ) {
+        queue->push([=]() -> void {
+          sortRange(part, numPart, depth, ignoreCase, queue);
+        });
+      } else {
+        sortRange(part, numPart, depth, ignoreCase, queue);
+      }
+    };
+
+    while( numItems > INSERTION_SORT_SIZE ) {
+      const uint64_t pivot = medianOf3(items[0].key,
+                                       items[numItems/2].key,
+                                       items[numItems - 1].key);
+
+      // Three-way partition: [0,lt) < pivot, [lt,gt) == pivot, [gt,numItems) > pivot
+      size_t lt = 0;
+      size_t gt = numItems;
+      for(size_t i = 0; i < gt; ) {
+        if(        items[i].key < pivot ) {
+          std::swap(items[lt++], items[i++]);
+        } else if( items[i].key > pivot ) {
+          std::swap(items[i], items[--gt]);
+        } else {
+          i++;
+        }
+      }
+
+      sortPart(items,      lt,            depth);
+      sortPart(items + gt, numItems - gt, depth);
+
+      if( Key<CharT>::isFinal(pivot) ) {
+        return;
+      }
+
+      // Equal keys: continue with the following characters
+      items    += lt;
+      numItems  = gt - lt;
+      depth    += Key<CharT>::NUM_UNITS;
+      loadKeys(items, numItems, depth, ignoreCase);
+    }
+
+    insertionSort(items, numItems, depth, ignoreCase);
+  }
+
+  template<typename CharT>
+  void sortItems(Item<CharT> *items, const size_t numItems, const bool ignoreCase,
+                 const int threadCount)
+  {
+    if( numItems < 1 ) {
+      return;
+    }
+
+    const size_t numThreads = numItems >= 2*MIN_TASK_SIZE
+        ? priv_parallel::threadCount(threadCount)
+        : 1;
+
+    const size_t numChunks = std::min(numThreads, numItems/MIN_TASK_SIZE + 1);
+    priv_parallel::run(numChunks, [=](const size_t i) -> void {
+      const size_t begin = numItems*i/numChunks;
+      const size_t end   = numItems*(i + 1)/numChunks;
+      for(size_t j = begin; j < end; j++) {
+        items[j].len = priv_simd::stringNLen(items[j].s, items[j].len);
+      }
+      loadKeys(items + begin, end - begin, 0, ignoreCase);
+    });
+
+    if( numThreads < 2 ) {
+      sortRange(items, numItems, 0, ignoreCase, 0);
+      return;
+    }
+
+    priv_parallel::TaskQueue queue(numThreads);
+    queue.push([=, &queue]() -> void {
+      sortRange(items, numItems, 0, ignoreCase, &queue);
+    });
+    queue.wait();
+  }
+
+}; // namespace priv_stringsort
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+void csStringSort(std::vector<csBasicString<CharT>>& strings, const bool ignoreCase,
+                  const int threadCount)
+{
+  using namespace priv_stringsort;
+
+  std::vector<Item<CharT>> items;
+  items.reserve(strings.size());
+  for(size_t i = 0; i < strings.size(); i++) {
+    items.push_back(Item<CharT>{0, strings[i].data(), strings[i].size(), i});
+  }
+
+  sortItems(items.data(), items.size(), ignoreCase, threadCount);
+
+  std::vector<csBasicString<CharT>> sorted;
+  sorted.reserve(strings.size());
+  for(const Item<CharT>& item : items) {
+    sorted.push_back(std::move(strings[item.index]));
+  }
+  strings.swap(sorted);
+}
+
+template<class StringT>
+void csStringSort(csBasicStringList<StringT>& list, const bool ignoreCase,
+                  const int threadCount)
+{
+  using namespace priv_stringsort;
+
+  typedef typename StringT::value_type CharT;
+  typedef typename csBasicStringList<StringT>::iterator IterT;
+
+  std::vector<IterT> iters;
+  std::vector<Item<CharT>> items;
+  iters.reserve(list.size());
+  items.reserve(list.size());
+  for(IterT iter = list.begin(); iter != list.end(); ++iter) {
+    items.push_back(Item<CharT>{0, iter->data(), iter->size(), iters.size()});
+    iters.push_back(iter);
+  }
+
+  sortItems(items.data(), items.size(), ignoreCase, threadCount);
+
+  for(const Item<CharT>& item : items) {
+    list.splice(list.end(), list, iters[item.index]);
+  }
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template void priv_stringsort::sortItems<char>(priv_stringsort::Item<char> *items, const size_t numItems, const bool ignoreCase, const int threadCount);
+template CS_CORE2_EXPORT void csStringSort<char>(std::vector<csBasicString<char>>& strings, const bool ignoreCase, const int threadCount);
+template CS_CORE2_EXPORT void csStringSort<csString>(csBasicStringList<csString>& list, const bool ignoreCase, const int threadCount);
+#endif
+
+#ifdef HAVE_WCHAR_T
+template void priv_stringsort::sortItems<wchar_t>(priv_stringsort::Item<wchar_t> *items, const size_t numItems, const bool ignoreCase, const int threadCount);
+template CS_CORE2_EXPORT void csStringSort<wchar_t>(std::vector<csBasicString<wchar_t>>& strings, const bool ignoreCase, const int threadCount);
+template CS_CORE2_EXPORT void csStringSort<csWString>(csBasicStringList<csWString>& list, const bool ignoreCase, const int threadCount);
+#endif
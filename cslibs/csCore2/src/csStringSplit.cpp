@@ -0,0 +1,190 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "csCore2/csStringSplit.h"
+
+#include "internal/simd_string.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_stringsplit {
+
+  // No further token; ends the iteration
+  const size_t NO_TOKEN = SIZE_MAX;
+
+}; // namespace priv_stringsplit
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csBasicStringSplit<CharT>::csBasicStringSplit(const csBasicStringView<CharT>& s,
+                                              const CharT delimiter,
+                                              const csSplitBehavior behavior)
+  : _s(s)
+  , _delimiter()
+  , _ch(delimiter)
+  , _type(Character)
+  , _behavior(behavior)
+{
+}
+
+template<typename CharT>
+csBasicStringSplit<CharT>::csBasicStringSplit(const csBasicStringView<CharT>& s,
+                                              const csBasicStringView<CharT>& delimiter,
+                                              const csSplitBehavior behavior)
+  : _s(s)
+  , _delimiter(delimiter)
+  , _ch(0)
+  , _type(Substring)
+  , _behavior(behavior)
+{
+}
+
+template<typename CharT>
+csBasicStringSplit<CharT>::csBasicStringSplit(const csBasicStringView<CharT>& s,
+                                              const csBasicStringView<CharT>& delimiter,
+                                              const DelimiterType type,
+                                              const csSplitBehavior behavior)
+  : _s(s)
+  , _delimiter(delimiter)
+  , _ch(0)
+  , _type(type)
+  , _behavior(behavior)
+{
+}
+
+template<typename CharT>
+csBasicStringSplit<CharT>::~csBasicStringSplit()
+{
+}
+
+template<typename CharT>
+csBasicStringSplit<CharT> csBasicStringSplit<CharT>::anyOf(const csBasicStringView<CharT>& s,
+                                                           const csBasicStringView<CharT>& delimiters,
+                                                           const csSplitBehavior behavior)
+{
+  return csBasicStringSplit<CharT>(s, delimiters, AnyOf, behavior);
+}
+
+template<typename CharT>
+csBasicStringTable<CharT> csBasicStringSplit<CharT>::collect() const
+{
+  csBasicStringTable<CharT> result;
+  // NOTE: The tokens never hold more characters than the split string.
+  result.reserve(0, _s.size());
+  for(const csBasicStringView<CharT>& token : *this) {
+    result.append(token);
+  }
+  return result;
+}
+
+////// private ///////////////////////////////////////////////////////////////
+
+template<typename CharT>
+size_t csBasicStringSplit<CharT>::findDelimiter(const size_t from) const
+{
+  const CharT *s   = _s.data() + from;
+  const size_t len = _s.size() - from;
+
+  size_t hit = priv_stringsplit::NO_TOKEN;
+  if(        _type == Character ) {
+    hit = priv_simd::stringFind(s, len, &_ch, 1, false);
+  } else if( _type == AnyOf  &&  !_delimiter.empty() ) {
+    hit = priv_simd::stringFindFirstOf(s, len, _delimiter.data(), _delimiter.size());
+  } else if( _type == Substring  &&  !_delimiter.empty() ) {
+    hit = priv_simd::stringFind(s, len, _delimiter.data(), _delimiter.size(), false);
+  }
+
+  return hit != priv_stringsplit::NO_TOKEN
+      ? from + hit
+      : priv_stringsplit::NO_TOKEN;
+}
+
+template<typename CharT>
+size_t csBasicStringSplit<CharT>::findNonDelimiter(const size_t from) const
+{
+  const CharT *s   = _s.data() + from;
+  const size_t len = _s.size() - from;
+
+  size_t hit = 0;
+  if(        _type == Character ) {
+    hit = priv_simd::stringFindFirstNotOf(s, len, &_ch, 1);
+  } else if( _type == AnyOf ) {
+    hit = priv_simd::stringFindFirstNotOf(s, len, _delimiter.data(), _delimiter.size());
+  }
+
+  return hit != priv_stringsplit::NO_TOKEN
+      ? from + hit
+      : priv_stringsplit::NO_TOKEN;
+}
+
+template<typename CharT>
+bool csBasicStringSplit<CharT>::nextToken(size_t *from, csBasicStringView<CharT> *token) const
+{
+  using namespace priv_stringsplit;
+
+  const bool skipEmpty = _behavior == csSkipEmptyParts;
+  while( *from != NO_TOKEN ) {
+    // Runs of single character delimiters are skipped at once
+    const size_t begin = skipEmpty  &&  _type != Substring
+        ? findNonDelimiter(*from)
+        : *from;
+    if( begin == NO_TOKEN ) {
+      *from = NO_TOKEN;
+      return false;
+    }
+
+    const size_t hit = findDelimiter(begin);
+    const size_t end = hit != NO_TOKEN
+        ? hit
+        : _s.size();
+    *from = hit != NO_TOKEN
+        ? hit + (_type == Substring  ?  _delimiter.size() : 1)
+        : NO_TOKEN;
+
+    if( !skipEmpty  ||  end > begin ) {
+      *token = csBasicStringView<CharT>(_s.data() + begin, end - begin);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringSplit<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringSplit<wchar_t>;
+#endif
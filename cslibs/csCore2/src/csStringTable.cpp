@@ -0,0 +1,174 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <utility>
+
+#include "csCore2/csStringTable.h"
+#include "csCore2/csUtil.h"
+
+#include "internal/stringsort.h"
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csBasicStringTable<CharT>::csBasicStringTable()
+  : _chars()
+  , _entries()
+{
+}
+
+template<typename CharT>
+csBasicStringTable<CharT>::csBasicStringTable(const csBasicStringTable<CharT>& other)
+  : _chars(other._chars)
+  , _entries(other._entries)
+{
+}
+
+template<typename CharT>
+csBasicStringTable<CharT>::csBasicStringTable(csBasicStringTable<CharT>&& other) noexcept
+  : _chars(std::move(other._chars))
+  , _entries(std::move(other._entries))
+{
+}
+
+template<typename CharT>
+csBasicStringTable<CharT>::~csBasicStringTable()
+{
+}
+
+template<typename CharT>
+csBasicStringTable<CharT>& csBasicStringTable<CharT>::operator=(const csBasicStringTable<CharT>& other)
+{
+  if( this != &other ) {
+    _chars   = other._chars;
+    _entries = other._entries;
+  }
+  return *this;
+}
+
+template<typename CharT>
+csBasicStringTable<CharT>& csBasicStringTable<CharT>::operator=(csBasicStringTable<CharT>&& other) noexcept
+{
+  if( this != &other ) {
+    _chars   = std::move(other._chars);
+    _entries = std::move(other._entries);
+  }
+  return *this;
+}
+
+template<typename CharT>
+void csBasicStringTable<CharT>::append(const csBasicStringView<CharT>& s)
+{
+  const Entry entry = { _chars.size(), s.size() };
+
+  if( _chars.data() <= s.data()  &&  s.data() < _chars.data() + _chars.size() ) {
+    // Growing the buffer would invalidate s
+    const std::vector<CharT> copy(s.begin(), s.end());
+    _chars.insert(_chars.end(), copy.begin(), copy.end());
+  } else {
+    _chars.insert(_chars.end(), s.begin(), s.end());
+  }
+  _chars.push_back(CharT(0));
+  _entries.push_back(entry);
+}
+
+template<typename CharT>
+void csBasicStringTable<CharT>::append(const CharT *s)
+{
+  append(csBasicStringView<CharT>(s));
+}
+
+template<typename CharT>
+void csBasicStringTable<CharT>::clear()
+{
+  _chars.clear();
+  _entries.clear();
+}
+
+template<typename CharT>
+void csBasicStringTable<CharT>::reserve(const size_t count, const size_t length)
+{
+  _chars.reserve(length + count);
+  _entries.reserve(count);
+}
+
+template<typename CharT>
+void csBasicStringTable<CharT>::sort(const bool ignoreCase, const int threadCount)
+{
+  std::vector<priv_stringsort::Item<CharT>> items;
+  items.reserve(_entries.size());
+  for(size_t i = 0; i < _entries.size(); i++) {
+    items.push_back(priv_stringsort::Item<CharT>{0, c_str(i), _entries[i].size, i});
+  }
+
+  priv_stringsort::sortItems(items.data(), items.size(), ignoreCase, threadCount);
+
+  std::vector<Entry> sorted;
+  sorted.reserve(_entries.size());
+  for(const priv_stringsort::Item<CharT>& item : items) {
+    sorted.push_back(_entries[item.index]);
+  }
+  _entries.swap(sorted);
+}
+
+template<typename CharT>
+void csBasicStringTable<CharT>::swap(csBasicStringTable<CharT>& other) noexcept
+{
+  _chars.swap(other._chars);
+  _entries.swap(other._entries);
+}
+
+template<typename CharT>
+void csBasicStringTable<CharT>::truncate(const size_t count)
+{
+  if( count >= _entries.size() ) {
+    return;
+  }
+
+  _entries.resize(count);
+
+  // NOTE: After sort(), the remaining characters need not be contiguous.
+  size_t numChars = 0;
+  for(const Entry& entry : _entries) {
+    numChars = csMax(numChars, entry.offset + entry.size + 1);
+  }
+  _chars.resize(numChars);
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringTable<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringTable<wchar_t>;
+#endif
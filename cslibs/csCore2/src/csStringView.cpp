@@ -0,0 +1,353 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "csCore2/csStringView.h"
+
+#include "csCore2/csChar.h"
+#include "csCore2/csUtil.h"
+
+#include "internal/simd_string.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_stringview {
+
+  template<typename CharT>
+  bool isEqual(const CharT *s1, const CharT *s2, const size_t len, const bool ignoreCase)
+  {
+    if( ignoreCase ) {
+      for(size_t i = 0; i < len; i++) {
+        if( csToLower(s1[i]) != csToLower(s2[i]) ) {
+          return false;
+        }
+      }
+      return true;
+    }
+    return std::char_traits<CharT>::compare(s1, s2, len) == 0;
+  }
+
+  template<typename CharT>
+  inline bool isSpace(const CharT ch)
+  {
+    return ch == CharT(' ')  ||  (CharT('\t') <= ch  &&  ch <= CharT('\r'));
+  }
+
+  template<typename CharT>
+  inline size_t stringLen(const CharT *s)
+  {
+    return s != 0
+        ? priv_simd::stringLen(s)
+        : 0;
+  }
+
+}; // namespace priv_stringview
+
+////// Implementation ////////////////////////////////////////////////////////
+
+template<typename CharT>
+csBasicStringView<CharT>::csBasicStringView() noexcept
+  : std::basic_string_view<CharT>()
+{
+}
+
+template<typename CharT>
+csBasicStringView<CharT>::csBasicStringView(const CharT *data)
+  : std::basic_string_view<CharT>(data, priv_stringview::stringLen(data))
+{
+}
+
+template<typename CharT>
+csBasicStringView<CharT>::csBasicStringView(const CharT *data, const size_t count) noexcept
+  : std::basic_string_view<CharT>(data, count)
+{
+}
+
+template<typename CharT>
+csBasicStringView<CharT>::csBasicStringView(const std::basic_string<CharT>& s) noexcept
+  : std::basic_string_view<CharT>(s.data(), s.size())
+{
+}
+
+template<typename CharT>
+csBasicStringView<CharT>::csBasicStringView(const std::basic_string_view<CharT>& other) noexcept
+  : std::basic_string_view<CharT>(other)
+{
+}
+
+template<typename CharT>
+int csBasicStringView<CharT>::compare(const csBasicStringView<CharT>& other,
+                                      const bool ignoreCase) const
+{
+  const size_t len = csMin(this->size(), other.size());
+  const size_t i = priv_simd::stringDifference(this->data(), other.data(), len, ignoreCase);
+  if( i < len ) {
+    return ignoreCase
+        ? int(csToLower(this->operator[](i)))-int(csToLower(other[i]))
+        : int(this->operator[](i))-int(other[i]);
+  }
+  if(        this->size() < other.size() ) {
+    return -1;
+  } else if( this->size() > other.size() ) {
+    return 1;
+  }
+  return 0;
+}
+
+template<typename CharT>
+bool csBasicStringView<CharT>::contains(const CharT ch, const bool ignoreCase) const
+{
+  return indexOf(ch, 0, ignoreCase) >= 0;
+}
+
+template<typename CharT>
+bool csBasicStringView<CharT>::contains(const csBasicStringView<CharT>& needle,
+                                        const bool ignoreCase) const
+{
+  return indexOf(needle, 0, ignoreCase) >= 0;
+}
+
+template<typename CharT>
+int csBasicStringView<CharT>::count(const csBasicStringView<CharT>& needle,
+                                    const bool ignoreCase) const
+{
+  return (int)priv_simd::stringCount(this->data(), this->size(),
+                                     needle.data(), needle.size(), ignoreCase);
+}
+
+template<typename CharT>
+bool csBasicStringView<CharT>::endsWith(const CharT ch, const bool ignoreCase) const
+{
+  if( this->empty() ) {
+    return false;
+  }
+  if( ignoreCase ) {
+    return csToLower(this->back()) == csToLower(ch);
+  }
+  return this->back() == ch;
+}
+
+template<typename CharT>
+bool csBasicStringView<CharT>::endsWith(const csBasicStringView<CharT>& other,
+                                        const bool ignoreCase) const
+{
+  if( this->empty()  ||  other.empty()  ||  other.size() > this->size() ) {
+    return false;
+  }
+  return priv_stringview::isEqual(this->data() + this->size() - other.size(),
+                                  other.data(), other.size(), ignoreCase);
+}
+
+template<typename CharT>
+int csBasicStringView<CharT>::indexOf(const CharT ch, const int from,
+                                      const bool ignoreCase) const
+{
+  const int indexFrom = from < 0
+      ? (int)this->size()+from
+      : from;
+
+  if( this->empty()  ||  indexFrom < 0  ||  (size_t)indexFrom >= this->size() ) {
+    return -1;
+  }
+
+  if( ignoreCase ) {
+    const size_t hit = priv_simd::stringFind(this->data() + indexFrom,
+                                             this->size() - (size_t)indexFrom, &ch, 1, true);
+    if( hit != SIZE_MAX ) {
+      return indexFrom + (int)hit;
+    }
+  } else {
+    const CharT *hit = std::char_traits<CharT>::find(this->data() + indexFrom,
+                                                     this->size() - (size_t)indexFrom, ch);
+    if( hit != 0 ) {
+      return (int)(hit - this->data());
+    }
+  }
+
+  return -1;
+}
+
+template<typename CharT>
+int csBasicStringView<CharT>::indexOf(const csBasicStringView<CharT>& needle, const int from,
+                                      const bool ignoreCase) const
+{
+  const int indexFrom = from < 0
+      ? (int)this->size()+from
+      : from;
+
+  if( this->empty()  ||  indexFrom < 0  ||  (size_t)indexFrom >= this->size() ) {
+    return -1;
+  }
+
+  const size_t hit = priv_simd::stringFind(this->data() + indexFrom,
+                                           this->size() - (size_t)indexFrom,
+                                           needle.data(), needle.size(), ignoreCase);
+  if( hit != SIZE_MAX ) {
+    return indexFrom + (int)hit;
+  }
+
+  return -1;
+}
+
+template<typename CharT>
+int csBasicStringView<CharT>::lastIndexOf(const CharT ch, const int from,
+                                          const bool ignoreCase) const
+{
+  const int indexFrom = from < 0
+      ? (int)this->size()+from
+      : from;
+
+  if( this->empty()  ||  indexFrom < 0  ||  (size_t)indexFrom >= this->size() ) {
+    return -1;
+  }
+
+  if( ignoreCase ) {
+    const CharT needle = csToLower(ch);
+    size_t i = (size_t)indexFrom;
+    do {
+      if( csToLower(this->operator[](i)) == needle ) {
+        return (int)i;
+      }
+    } while( i-- );
+  } else {
+    size_t i = (size_t)indexFrom;
+    do {
+      if( this->operator[](i) == ch ) {
+        return (int)i;
+      }
+    } while( i-- );
+  }
+
+  return -1;
+}
+
+template<typename CharT>
+int csBasicStringView<CharT>::lastIndexOf(const csBasicStringView<CharT>& needle, const int from,
+                                          const bool ignoreCase) const
+{
+  const int indexFrom = from < 0
+      ? (int)this->size()+from
+      : from;
+
+  if( this->empty()  ||  indexFrom < 0  ||  (size_t)indexFrom >= this->size() ) {
+    return -1;
+  }
+
+  // Occurrences must start at or before indexFrom
+  const size_t len = csMin((size_t)indexFrom + needle.size(), this->size());
+  const size_t hit = priv_simd::stringFindLast(this->data(), len,
+                                               needle.data(), needle.size(), ignoreCase);
+  if( hit != SIZE_MAX ) {
+    return (int)hit;
+  }
+
+  return -1;
+}
+
+template<typename CharT>
+csBasicStringView<CharT> csBasicStringView<CharT>::left(const int n) const
+{
+  if( n < 1 ) {
+    return csBasicStringView<CharT>();
+  }
+  return csBasicStringView<CharT>(this->data(), csMin((size_t)n, this->size()));
+}
+
+template<typename CharT>
+csBasicStringView<CharT> csBasicStringView<CharT>::mid(const int pos, const int n) const
+{
+  if( this->empty()  ||  pos < 0  ||  (size_t)pos >= this->size() ) {
+    return csBasicStringView<CharT>();
+  }
+
+  const size_t len = n < 1
+      ? this->size() - (size_t)pos
+      : csMin((size_t)n, this->size() - (size_t)pos);
+
+  return csBasicStringView<CharT>(this->data() + pos, len);
+}
+
+template<typename CharT>
+csBasicStringView<CharT> csBasicStringView<CharT>::right(const int n) const
+{
+  if( n < 1 ) {
+    return csBasicStringView<CharT>();
+  }
+  const size_t len = csMin((size_t)n, this->size());
+  return csBasicStringView<CharT>(this->data() + this->size() - len, len);
+}
+
+template<typename CharT>
+bool csBasicStringView<CharT>::startsWith(const CharT ch, const bool ignoreCase) const
+{
+  if( this->empty() ) {
+    return false;
+  }
+  if( ignoreCase ) {
+    return csToLower(this->front()) == csToLower(ch);
+  }
+  return this->front() == ch;
+}
+
+template<typename CharT>
+bool csBasicStringView<CharT>::startsWith(const csBasicStringView<CharT>& other,
+                                          const bool ignoreCase) const
+{
+  if( this->empty()  ||  other.empty()  ||  other.size() > this->size() ) {
+    return false;
+  }
+  return priv_stringview::isEqual(this->data(), other.data(), other.size(), ignoreCase);
+}
+
+template<typename CharT>
+csBasicStringView<CharT> csBasicStringView<CharT>::trimmed() const
+{
+  size_t first = 0;
+  while( first < this->size()  &&  priv_stringview::isSpace(this->operator[](first)) ) {
+    first++;
+  }
+
+  size_t last = this->size();
+  while( last > first  &&  priv_stringview::isSpace(this->operator[](last - 1)) ) {
+    last--;
+  }
+
+  return csBasicStringView<CharT>(this->data() + first, last - first);
+}
+
+////// Explicit instantiation ////////////////////////////////////////////////
+
+#ifdef HAVE_CHAR
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringView<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+template class CS_CORE2_EXPORT_INSTANTIATION csBasicStringView<wchar_t>;
+#endif
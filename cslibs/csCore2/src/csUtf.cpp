@@ -0,0 +1,806 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <algorithm>
+
+#include "csCore2/csUtf.h"
+
+#include "internal/cpu.h"
+
+#ifdef CS_ARCH_X86
+# include <immintrin.h>
+#endif
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_utf {
+
+  // NOTE: Characters which are transcoded 1:1 (ASCII between UTF-8 and
+  //       UTF-16/32; anything but surrogates between UTF-16 and UTF-32)
+  //       are "simple" and converted in bulk by the vector kernels.
+
+  inline bool isSimple(const char16_t c, const uint8_t* /*out*/)
+  {
+    return c < 0x80;
+  }
+
+  inline bool isSimple(const char16_t c, const char32_t* /*out*/)
+  {
+    return (c & 0xF800) != 0xD800;
+  }
+
+  inline bool isSimple(const char32_t c, const uint8_t* /*out*/)
+  {
+    return c < 0x80;
+  }
+
+  inline bool isSimple(const char32_t c, const char16_t* /*out*/)
+  {
+    return c < 0xD800  ||  (0xE000 <= c  &&  c < 0x10000);
+  }
+
+  template<typename OutT>
+  inline bool isSimple(const uint8_t c, const OutT* /*out*/)
+  {
+    return c < 0x80;
+  }
+
+  ////// Scalar //////////////////////////////////////////////////////////////
+
+  inline bool isContinuation(const uint8_t c)
+  {
+    return (c & 0xC0) == 0x80;
+  }
+
+  // Returns the number of code units decoded; 0 on error.
+  inline size_t decode(const uint8_t *s, const size_t len, char32_t *cp, csUtfError *error)
+  {
+    const uint8_t c0 = s[0];
+    if( c0 < 0x80 ) {
+      *cp = c0;
+      return 1;
+    }
+
+    // Lead byte: length & valid range of the second byte (RFC 3629)
+    size_t n;
+    uint8_t lo = 0x80;
+    uint8_t hi = 0xBF;
+    if(        0xC2 <= c0  &&  c0 <= 0xDF ) {
+      n = 2;
+    } else if( 0xE0 <= c0  &&  c0 <= 0xEF ) {
+      n = 3;
+      if(        c0 == 0xE0 ) {
+        lo = 0xA0; // overlong
+      } else if( c0 == 0xED ) {
+        hi = 0x9F; // surrogates
+      }
+    } else if( 0xF0 <= c0  &&  c0 <= 0xF4 ) {
+      n = 4;
+      if(        c0 == 0xF0 ) {
+        lo = 0x90; // overlong
+      } else if( c0 == 0xF4 ) {
+        hi = 0x8F; // > U+10FFFF
+      }
+    } else {
+      *error = csUtfInvalidSequence;
+      return 0;
+    }
+
+    if( len < 2 ) {
+      *error = csUtfIncomplete;
+      return 0;
+    }
+    if( s[1] < lo  ||  s[1] > hi ) {
+      *error = csUtfInvalidSequence;
+      return 0;
+    }
+    for(size_t i = 2; i < n; i++) {
+      if( i >= len ) {
+        *error = csUtfIncomplete;
+        return 0;
+      }
+      if( !isContinuation(s[i]) ) {
+        *error = csUtfInvalidSequence;
+        return 0;
+      }
+    }
+
+    if(        n == 2 ) {
+      *cp = (char32_t(c0 & 0x1F) << 6) | char32_t(s[1] & 0x3F);
+    } else if( n == 3 ) {
+      *cp = (char32_t(c0 & 0x0F) << 12) | (char32_t(s[1] & 0x3F) << 6) |
+          char32_t(s[2] & 0x3F);
+    } else {
+      *cp = (char32_t(c0 & 0x07) << 18) | (char32_t(s[1] & 0x3F) << 12) |
+          (char32_t(s[2] & 0x3F) << 6) | char32_t(s[3] & 0x3F);
+    }
+
+    return n;
+  }
+
+  inline size_t decode(const char16_t *s, const size_t len, char32_t *cp, csUtfError *error)
+  {
+    const char16_t c0 = s[0];
+    if( (c0 & 0xF800) != 0xD800 ) {
+      *cp = c0;
+      return 1;
+    }
+
+    if( c0 >= 0xDC00 ) { // unpaired low surrogate
+      *error = csUtfInvalidSequence;
+      return 0;
+    }
+    if( len < 2 ) {
+      *error = csUtfIncomplete;
+      return 0;
+    }
+    if( (s[1] & 0xFC00) != 0xDC00 ) {
+      *error = csUtfInvalidSequence;
+      return 0;
+    }
+
+    *cp = 0x10000 + ((char32_t(c0 & 0x3FF) << 10) | char32_t(s[1] & 0x3FF));
+    return 2;
+  }
+
+  inline size_t decode(const char32_t *s, const size_t /*len*/, char32_t *cp, csUtfError *error)
+  {
+    const char32_t c0 = s[0];
+    if( c0 > 0x10FFFF  ||  (c0 & 0xFFFFF800) == 0xD800 ) {
+      *error = csUtfInvalidSequence;
+      return 0;
+    }
+
+    *cp = c0;
+    return 1;
+  }
+
+  // Returns the number of code units written; 0 if capacity is too small.
+  inline size_t encode(const char32_t cp, uint8_t *out, const size_t capacity)
+  {
+    if(        cp < 0x80 ) {
+      if( capacity < 1 ) {
+        return 0;
+      }
+      out[0] = uint8_t(cp);
+      return 1;
+    } else if( cp < 0x800 ) {
+      if( capacity < 2 ) {
+        return 0;
+      }
+      out[0] = uint8_t(0xC0 | (cp >> 6));
+      out[1] = uint8_t(0x80 | (cp & 0x3F));
+      return 2;
+    } else if( cp < 0x10000 ) {
+      if( capacity < 3 ) {
+        return 0;
+      }
+      out[0] = uint8_t(0xE0 | (cp >> 12));
+      out[1] = uint8_t(0x80 | ((cp >> 6) & 0x3F));
+      out[2] = uint8_t(0x80 | (cp & 0x3F));
+      return 3;
+    }
+    if( capacity < 4 ) {
+      return 0;
+    }
+    out[0] = uint8_t(0xF0 | (cp >> 18));
+    out[1] = uint8_t(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = uint8_t(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = uint8_t(0x80 | (cp & 0x3F));
+    return 4;
+  }
+
+  inline size_t encode(const char32_t cp, char16_t *out, const size_t capacity)
+  {
+    if( cp < 0x10000 ) {
+      if( capacity < 1 ) {
+        return 0;
+      }
+      out[0] = char16_t(cp);
+      return 1;
+    }
+    if( capacity < 2 ) {
+      return 0;
+    }
+    out[0] = char16_t(0xD800 + ((cp - 0x10000) >> 10));
+    out[1] = char16_t(0xDC00 + ((cp - 0x10000) & 0x3FF));
+    return 2;
+  }
+
+  inline size_t encode(const char32_t cp, char32_t *out, const size_t capacity)
+  {
+    if( capacity < 1 ) {
+      return 0;
+    }
+    out[0] = cp;
+    return 1;
+  }
+
+  // Converts the leading simple characters; returns their count.
+  template<typename InT, typename OutT>
+  size_t convertSimple_scalar(const InT *in, const size_t count, OutT *out)
+  {
+    size_t i = 0;
+    for(; i < count  &&  isSimple(in[i], out); i++) {
+      out[i] = OutT(in[i]);
+    }
+    return i;
+  }
+
+  inline size_t asciiLength_scalar(const uint8_t *s, const size_t len)
+  {
+    size_t i = 0;
+    for(; i < len  &&  s[i] < 0x80; i++) {
+    }
+    return i;
+  }
+
+#ifdef CS_ARCH_X86
+
+  ////// SSE2 ////////////////////////////////////////////////////////////////
+
+  CS_TARGET_SSE2 inline __m128i loadu_sse2(const void *p)
+  {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  }
+
+  CS_TARGET_SSE2 inline void storeu_sse2(void *p, const __m128i x)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), x);
+  }
+
+  template<typename InT, typename OutT>
+  CS_TARGET_SSE2 size_t convertSimple_sse2(const InT *in, const size_t count, OutT *out);
+
+  // UTF-8 -> UTF-16; 16 ASCII characters per iteration
+  template<>
+  CS_TARGET_SSE2 size_t convertSimple_sse2(const uint8_t *in, const size_t count, char16_t *out)
+  {
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+      const __m128i x = loadu_sse2(in + i);
+      if( _mm_movemask_epi8(x) != 0 ) {
+        break;
+      }
+      storeu_sse2(out + i,     _mm_unpacklo_epi8(x, zero));
+      storeu_sse2(out + i + 8, _mm_unpackhi_epi8(x, zero));
+    }
+
+    return i + convertSimple_scalar(in + i, count - i, out + i);
+  }
+
+  // UTF-8 -> UTF-32
+  template<>
+  CS_TARGET_SSE2 size_t convertSimple_sse2(const uint8_t *in, const size_t count, char32_t *out)
+  {
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+      const __m128i x = loadu_sse2(in + i);
+      if( _mm_movemask_epi8(x) != 0 ) {
+        break;
+      }
+      const __m128i lo = _mm_unpacklo_epi8(x, zero);
+      const __m128i hi = _mm_unpackhi_epi8(x, zero);
+      storeu_sse2(out + i,      _mm_unpacklo_epi16(lo, zero));
+      storeu_sse2(out + i +  4, _mm_unpackhi_epi16(lo, zero));
+      storeu_sse2(out + i +  8, _mm_unpacklo_epi16(hi, zero));
+      storeu_sse2(out + i + 12, _mm_unpackhi_epi16(hi, zero));
+    }
+
+    return i + convertSimple_scalar(in + i, count - i, out + i);
+  }
+
+  // UTF-16 -> UTF-8
+  template<>
+  CS_TARGET_SSE2 size_t convertSimple_sse2(const char16_t *in, const size_t count, uint8_t *out)
+  {
+    const __m128i nonAscii = _mm_set1_epi16(short(0xFF80));
+
+    size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+      const __m128i lo = loadu_sse2(in + i);
+      const __m128i hi = loadu_sse2(in + i + 8);
+      const __m128i test = _mm_and_si128(_mm_or_si128(lo, hi), nonAscii);
+      if( _mm_movemask_epi8(_mm_cmpeq_epi16(test, _mm_setzero_si128())) != 0xFFFF ) {
+        break;
+      }
+      storeu_sse2(out + i, _mm_packus_epi16(lo, hi));
+    }
+
+    return i + convertSimple_scalar(in + i, count - i, out + i);
+  }
+
+  // UTF-16 -> UTF-32
+  template<>
+  CS_TARGET_SSE2 size_t convertSimple_sse2(const char16_t *in, const size_t count, char32_t *out)
+  {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask = _mm_set1_epi16(short(0xF800));
+    const __m128i surr = _mm_set1_epi16(short(0xD800));
+
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+      const __m128i x = loadu_sse2(in + i);
+      if( _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(x, mask), surr)) != 0 ) {
+        break;
+      }
+      storeu_sse2(out + i,     _mm_unpacklo_epi16(x, zero));
+      storeu_sse2(out + i + 4, _mm_unpackhi_epi16(x, zero));
+    }
+
+    return i + convertSimple_scalar(in + i, count - i, out + i);
+  }
+
+  // UTF-32 -> UTF-8
+  template<>
+  CS_TARGET_SSE2 size_t convertSimple_sse2(const char32_t *in, const size_t count, uint8_t *out)
+  {
+    const __m128i nonAscii = _mm_set1_epi32(int(0xFFFFFF80));
+
+    size_t i = 0;
+    for(; i + 16 <= count; i += 16) {
+      const __m128i x0 = loadu_sse2(in + i);
+      const __m128i x1 = loadu_sse2(in + i +  4);
+      const __m128i x2 = loadu_sse2(in + i +  8);
+      const __m128i x3 = loadu_sse2(in + i + 12);
+      const __m128i test = _mm_and_si128(_mm_or_si128(_mm_or_si128(x0, x1),
+                                                      _mm_or_si128(x2, x3)), nonAscii);
+      if( _mm_movemask_epi8(_mm_cmpeq_epi32(test, _mm_setzero_si128())) != 0xFFFF ) {
+        break;
+      }
+      storeu_sse2(out + i, _mm_packus_epi16(_mm_packs_epi32(x0, x1), _mm_packs_epi32(x2, x3)));
+    }
+
+    return i + convertSimple_scalar(in + i, count - i, out + i);
+  }
+
+  // UTF-32 -> UTF-16
+  template<>
+  CS_TARGET_SSE2 size_t convertSimple_sse2(const char32_t *in, const size_t count, char16_t *out)
+  {
+    // NOTE: SSE2 has no unsigned saturating 32 -> 16 bit pack; biasing
+    //       [0,0xFFFF] into the signed range makes it lossless.
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16(short(0x8000));
+    const __m128i mask   = _mm_set1_epi32(int(0xFFFFF800));
+    const __m128i surr   = _mm_set1_epi32(0xD800);
+    const __m128i bmp    = _mm_set1_epi32(int(0xFFFF0000));
+    const __m128i zero   = _mm_setzero_si128();
+
+    size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+      const __m128i lo = loadu_sse2(in + i);
+      const __m128i hi = loadu_sse2(in + i + 4);
+      const __m128i isSurr = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(lo, mask), surr),
+                                          _mm_cmpeq_epi32(_mm_and_si128(hi, mask), surr));
+      const __m128i isBmp  = _mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(lo, hi), bmp), zero);
+      if( _mm_movemask_epi8(isSurr) != 0  ||  _mm_movemask_epi8(isBmp) != 0xFFFF ) {
+        break;
+      }
+      const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(lo, bias32),
+                                             _mm_sub_epi32(hi, bias32));
+      storeu_sse2(out + i, _mm_add_epi16(packed, bias16));
+    }
+
+    return i + convertSimple_scalar(in + i, count - i, out + i);
+  }
+
+  CS_TARGET_SSE2 size_t asciiLength_sse2(const uint8_t *s, const size_t len)
+  {
+    size_t i = 0;
+    for(; i + 16 <= len; i += 16) {
+      const int mask = _mm_movemask_epi8(loadu_sse2(s + i));
+      if( mask != 0 ) {
+        return i + size_t(priv_cpu::ctz32(uint32_t(mask)));
+      }
+    }
+    return i + asciiLength_scalar(s + i, len - i);
+  }
+
+  ////// AVX2 ////////////////////////////////////////////////////////////////
+
+  CS_TARGET_AVX2 inline __m256i loadu_avx2(const void *p)
+  {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  }
+
+  CS_TARGET_AVX2 inline void storeu_avx2(void *p, const __m256i x)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), x);
+  }
+
+  template<typename InT, typename OutT>
+  CS_TARGET_AVX2 size_t convertSimple_avx2(const InT *in, const size_t count, OutT *out)
+  {
+    return convertSimple_sse2(in, count, out);
+  }
+
+  // UTF-8 -> UTF-16; 32 ASCII characters per iteration
+  template<>
+  CS_TARGET_AVX2 size_t convertSimple_avx2(const uint8_t *in, const size_t count, char16_t *out)
+  {
+    size_t i = 0;
+    for(; i + 32 <= count; i += 32) {
+      const __m256i x = loadu_avx2(in + i);
+      if( _mm256_movemask_epi8(x) != 0 ) {
+        break;
+      }
+      storeu_avx2(out + i,      _mm256_cvtepu8_epi16(_mm256_castsi256_si128(x)));
+      storeu_avx2(out + i + 16, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(x, 1)));
+    }
+
+    return i + convertSimple_sse2(in + i, count - i, out + i);
+  }
+
+  // UTF-8 -> UTF-32
+  template<>
+  CS_TARGET_AVX2 size_t convertSimple_avx2(const uint8_t *in, const size_t count, char32_t *out)
+  {
+    size_t i = 0;
+    for(; i + 32 <= count; i += 32) {
+      const __m256i x = loadu_avx2(in + i);
+      if( _mm256_movemask_epi8(x) != 0 ) {
+        break;
+      }
+      const __m128i lo = _mm256_castsi256_si128(x);
+      const __m128i hi = _mm256_extracti128_si256(x, 1);
+      storeu_avx2(out + i,      _mm256_cvtepu8_epi32(lo));
+      storeu_avx2(out + i +  8, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+      storeu_avx2(out + i + 16, _mm256_cvtepu8_epi32(hi));
+      storeu_avx2(out + i + 24, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+    }
+
+    return i + convertSimple_sse2(in + i, count - i, out + i);
+  }
+
+  // UTF-16 -> UTF-8
+  template<>
+  CS_TARGET_AVX2 size_t convertSimple_avx2(const char16_t *in, const size_t count, uint8_t *out)
+  {
+    const __m256i nonAscii = _mm256_set1_epi16(short(0xFF80));
+
+    size_t i = 0;
+    for(; i + 32 <= count; i += 32) {
+      const __m256i lo = loadu_avx2(in + i);
+      const __m256i hi = loadu_avx2(in + i + 16);
+      if( !_mm256_testz_si256(_mm256_or_si256(lo, hi), nonAscii) ) {
+        break;
+      }
+      // NOTE: The pack interleaves the 128-bit lanes.
+      const __m256i packed = _mm256_packus_epi16(lo, hi);
+      storeu_avx2(out + i, _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+
+    return i + convertSimple_sse2(in + i, count - i, out + i);
+  }
+
+  // UTF-32 -> UTF-8
+  template<>
+  CS_TARGET_AVX2 size_t convertSimple_avx2(const char32_t *in, const size_t count, uint8_t *out)
+  {
+    const __m256i nonAscii = _mm256_set1_epi32(int(0xFFFFFF80));
+    const __m256i order    = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    size_t i = 0;
+    for(; i + 32 <= count; i += 32) {
+      const __m256i x0 = loadu_avx2(in + i);
+      const __m256i x1 = loadu_avx2(in + i +  8);
+      const __m256i x2 = loadu_avx2(in + i + 16);
+      const __m256i x3 = loadu_avx2(in + i + 24);
+      const __m256i any = _mm256_or_si256(_mm256_or_si256(x0, x1), _mm256_or_si256(x2, x3));
+      if( !_mm256_testz_si256(any, nonAscii) ) {
+        break;
+      }
+      const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(x0, x1),
+                                                 _mm256_packs_epi32(x2, x3));
+      storeu_avx2(out + i, _mm256_permutevar8x32_epi32(packed, order));
+    }
+
+    return i + convertSimple_sse2(in + i, count - i, out + i);
+  }
+
+  CS_TARGET_AVX2 size_t asciiLength_avx2(const uint8_t *s, const size_t len)
+  {
+    size_t i = 0;
+    for(; i + 32 <= len; i += 32) {
+      const int mask = _mm256_movemask_epi8(loadu_avx2(s + i));
+      if( mask != 0 ) {
+        return i + size_t(priv_cpu::ctz32(uint32_t(mask)));
+      }
+    }
+    return i + asciiLength_sse2(s + i, len - i);
+  }
+
+#endif // CS_ARCH_X86
+
+  ////// Dispatch ////////////////////////////////////////////////////////////
+
+  struct Kernels {
+    template<typename InT, typename OutT>
+    using convertSimple_func = size_t (*)(const InT*, const size_t, OutT*);
+
+    using asciiLength_func = size_t (*)(const uint8_t*, const size_t);
+
+    Kernels()
+      : utf8ToUtf16(convertSimple_scalar<uint8_t,char16_t>)
+      , utf8ToUtf32(convertSimple_scalar<uint8_t,char32_t>)
+      , utf16ToUtf8(convertSimple_scalar<char16_t,uint8_t>)
+      , utf16ToUtf32(convertSimple_scalar<char16_t,char32_t>)
+      , utf32ToUtf8(convertSimple_scalar<char32_t,uint8_t>)
+      , utf32ToUtf16(convertSimple_scalar<char32_t,char16_t>)
+      , asciiLength(asciiLength_scalar)
+    {
+#ifdef CS_ARCH_X86
+      const priv_cpu::Level level = priv_cpu::level();
+      if(        level >= priv_cpu::AVX2 ) {
+        utf8ToUtf16  = convertSimple_avx2<uint8_t,char16_t>;
+        utf8ToUtf32  = convertSimple_avx2<uint8_t,char32_t>;
+        utf16ToUtf8  = convertSimple_avx2<char16_t,uint8_t>;
+        utf16ToUtf32 = convertSimple_avx2<char16_t,char32_t>;
+        utf32ToUtf8  = convertSimple_avx2<char32_t,uint8_t>;
+        utf32ToUtf16 = convertSimple_avx2<char32_t,char16_t>;
+        asciiLength  = asciiLength_avx2;
+      } else if( level >= priv_cpu::SSE2 ) {
+        utf8ToUtf16  = convertSimple_sse2<uint8_t,char16_t>;
+        utf8ToUtf32  = convertSimple_sse2<uint8_t,char32_t>;
+        utf16ToUtf8  = convertSimple_sse2<char16_t,uint8_t>;
+        utf16ToUtf32 = convertSimple_sse2<char16_t,char32_t>;
+        utf32ToUtf8  = convertSimple_sse2<char32_t,uint8_t>;
+        utf32ToUtf16 = convertSimple_sse2<char32_t,char16_t>;
+        asciiLength  = asciiLength_sse2;
+      }
+#endif
+    }
+
+    static const Kernels& get()
+    {
+      static const Kernels kernels;
+      return kernels;
+    }
+
+    convertSimple_func<uint8_t,char16_t>  utf8ToUtf16;
+    convertSimple_func<uint8_t,char32_t>  utf8ToUtf32;
+    convertSimple_func<char16_t,uint8_t>  utf16ToUtf8;
+    convertSimple_func<char16_t,char32_t> utf16ToUtf32;
+    convertSimple_func<char32_t,uint8_t>  utf32ToUtf8;
+    convertSimple_func<char32_t,char16_t> utf32ToUtf16;
+
+    asciiLength_func asciiLength;
+  };
+
+  template<typename InT, typename OutT>
+  csUtfResult transcode(const InT *in, const size_t len, OutT *out, const size_t capacity,
+                        const Kernels::convertSimple_func<InT,OutT> convertSimple)
+  {
+    csUtfResult result;
+    result.read    = 0;
+    result.written = 0;
+    result.error   = csUtfNoError;
+
+    size_t i = 0;
+    size_t o = 0;
+    while( i < len ) {
+      if( isSimple(in[i], out) ) {
+        const size_t count = convertSimple(in + i, std::min(len - i, capacity - o), out + o);
+        if( count < 1 ) {
+          result.error = csUtfOutputTooSmall;
+          break;
+        }
+        i += count;
+        o += count;
+        continue;
+      }
+
+      char32_t cp;
+      const size_t numRead = decode(in + i, len - i, &cp, &result.error);
+      if( numRead < 1 ) {
+        break;
+      }
+
+      const size_t numWritten = encode(cp, out + o, capacity - o);
+      if( numWritten < 1 ) {
+        result.error = csUtfOutputTooSmall;
+        break;
+      }
+
+      i += numRead;
+      o += numWritten;
+    }
+
+    result.read    = i;
+    result.written = o;
+
+    return result;
+  }
+
+  // Converts in blocks via a buffer on the stack; appending the blocks
+  // avoids initializing a string of the worst-case size.
+  template<typename StringT, typename InT, typename FuncT>
+  void convertString(StringT *str, const InT *in, const size_t len,
+                     FuncT convert, csUtfResult *result)
+  {
+    typedef typename StringT::value_type OutT;
+
+    const size_t BLOCK_SIZE = 1024;
+
+    OutT buffer[4*BLOCK_SIZE];
+
+    csUtfResult r;
+    r.read    = 0;
+    r.written = 0;
+    r.error   = csUtfNoError;
+
+    size_t i = 0;
+    while( i < len ) {
+      const size_t count = std::min(len - i, BLOCK_SIZE);
+
+      const csUtfResult block = convert(in + i, count, buffer, 4*BLOCK_SIZE);
+      str->append(buffer, block.written);
+      i         += block.read;
+      r.written += block.written;
+
+      // Sequences crossing the block's end are converted with the next block
+      const bool isSplit = block.error == csUtfIncomplete  &&  i + (count - block.read) < len;
+      if( block.error != csUtfNoError  &&  !isSplit ) {
+        r.error = block.error;
+        break;
+      }
+    }
+    r.read = i;
+
+    if( result != 0 ) {
+      *result = r;
+    }
+  }
+
+  inline const uint8_t *bytes(const char *s)
+  {
+    return reinterpret_cast<const uint8_t*>(s);
+  }
+
+  inline uint8_t *bytes(char *s)
+  {
+    return reinterpret_cast<uint8_t*>(s);
+  }
+
+}; // namespace priv_utf
+
+////// Implementation ////////////////////////////////////////////////////////
+
+CS_CORE2_EXPORT csUtfResult csUtf8ToUtf16(const char *in, const size_t len,
+                                          char16_t *out, const size_t capacity)
+{
+  using namespace priv_utf;
+  return transcode(bytes(in), len, out, capacity, Kernels::get().utf8ToUtf16);
+}
+
+CS_CORE2_EXPORT csUtfResult csUtf8ToUtf32(const char *in, const size_t len,
+                                          char32_t *out, const size_t capacity)
+{
+  using namespace priv_utf;
+  return transcode(bytes(in), len, out, capacity, Kernels::get().utf8ToUtf32);
+}
+
+CS_CORE2_EXPORT csUtfResult csUtf16ToUtf8(const char16_t *in, const size_t len,
+                                          char *out, const size_t capacity)
+{
+  using namespace priv_utf;
+  return transcode(in, len, bytes(out), capacity, Kernels::get().utf16ToUtf8);
+}
+
+CS_CORE2_EXPORT csUtfResult csUtf16ToUtf32(const char16_t *in, const size_t len,
+                                           char32_t *out, const size_t capacity)
+{
+  using namespace priv_utf;
+  return transcode(in, len, out, capacity, Kernels::get().utf16ToUtf32);
+}
+
+CS_CORE2_EXPORT csUtfResult csUtf32ToUtf8(const char32_t *in, const size_t len,
+                                          char *out, const size_t capacity)
+{
+  using namespace priv_utf;
+  return transcode(in, len, bytes(out), capacity, Kernels::get().utf32ToUtf8);
+}
+
+CS_CORE2_EXPORT csUtfResult csUtf32ToUtf16(const char32_t *in, const size_t len,
+                                           char16_t *out, const size_t capacity)
+{
+  using namespace priv_utf;
+  return transcode(in, len, out, capacity, Kernels::get().utf32ToUtf16);
+}
+
+CS_CORE2_EXPORT size_t csValidUtf8Length(const char *s, const size_t len)
+{
+  using namespace priv_utf;
+
+  const Kernels& kernels = Kernels::get();
+  const uint8_t *p = bytes(s);
+
+  size_t i = 0;
+  while( i < len ) {
+    if( p[i] < 0x80 ) {
+      i += kernels.asciiLength(p + i, len - i);
+      continue;
+    }
+
+    char32_t cp;
+    csUtfError error;
+    const size_t n = decode(p + i, len - i, &cp, &error);
+    if( n < 1 ) {
+      break;
+    }
+    i += n;
+  }
+
+  return i;
+}
+
+CS_CORE2_EXPORT size_t csValidUtf16Length(const char16_t *s, const size_t len)
+{
+  using namespace priv_utf;
+
+  size_t i = 0;
+  while( i < len ) {
+    char32_t cp;
+    csUtfError error;
+    const size_t n = decode(s + i, len - i, &cp, &error);
+    if( n < 1 ) {
+      break;
+    }
+    i += n;
+  }
+
+  return i;
+}
+
+#ifdef HAVE_WCHAR_T
+
+CS_CORE2_EXPORT csWString csFromUtf8(const std::string_view& s, csUtfResult *result)
+{
+  csWString str;
+  str.reserve(s.size());
+  priv_utf::convertString(&str, s.data(), s.size(), csUtf8ToWide, result);
+  return str;
+}
+
+CS_CORE2_EXPORT std::string csToUtf8(const csWStringView& s, csUtfResult *result)
+{
+  std::string str;
+  str.reserve(s.size());
+  priv_utf::convertString(&str, s.data(), s.size(), csWideToUtf8, result);
+  return str;
+}
+
+#endif
@@ -0,0 +1,1585 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "internal/simd_string.h"
+
+#include <cstring>
+
+#include "internal/cpu.h"
+#include "internal/twoway.h"
+
+#ifdef CS_ARCH_X86
+# include <immintrin.h>
+#endif
+
+#include "csCore2/csUtil.h"
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_simd {
+
+  ////// Scalar //////////////////////////////////////////////////////////////
+
+  template<typename T>
+  inline T toLower_scalar(const T x)
+  {
+    return T(x - T('A')) < T(26)
+        ? T(x + T(0x20))
+        : x;
+  }
+
+  template<typename T>
+  inline T toUpper_scalar(const T x)
+  {
+    return T(x - T('a')) < T(26)
+        ? T(x - T(0x20))
+        : x;
+  }
+
+  // TERMINATED: a zero element of s1 counts as mismatch
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  inline bool isMismatch_scalar(const T a, const T b)
+  {
+    const bool isEnd = TERMINATED  &&  a == T(0);
+    if( IGNORE_CASE ) {
+      return toLower_scalar(a) != toLower_scalar(b)  ||  isEnd;
+    }
+    return a != b  ||  isEnd;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  inline T fold_scalar(const T x)
+  {
+    return IGNORE_CASE
+        ? toLower_scalar(x)
+        : x;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  inline bool isEqual_scalar(const T *s1, const T *s2, const size_t len)
+  {
+    if( IGNORE_CASE ) {
+      for(size_t i = 0; i < len; i++) {
+        if( toLower_scalar(s1[i]) != toLower_scalar(s2[i]) ) {
+          return false;
+        }
+      }
+      return true;
+    }
+    return memcmp(s1, s2, len*sizeof(T)) == 0;
+  }
+
+  template<typename T>
+  size_t findZero_scalar(const T *s, const size_t maxcount)
+  {
+    size_t i = 0;
+    while( i < maxcount  &&  s[i] != T(0) ) {
+      i++;
+    }
+    return i;
+  }
+
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  size_t findMismatch_scalar(const T *s1, const T *s2, const size_t maxcount)
+  {
+    for(size_t i = 0; i < maxcount; i++) {
+      if( isMismatch_scalar<T,IGNORE_CASE,TERMINATED>(s1[i], s2[i]) ) {
+        return i;
+      }
+    }
+    return maxcount;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  size_t findSubstring_scalar(const T *hay, const size_t n, const T *needle, const size_t m)
+  {
+    const T first = fold_scalar<T,IGNORE_CASE>(needle[0]);
+    for(size_t i = 0; i + m <= n; i++) {
+      if( fold_scalar<T,IGNORE_CASE>(hay[i]) == first  &&
+          isEqual_scalar<T,IGNORE_CASE>(hay + i + 1, needle + 1, m - 1) ) {
+        return i;
+      }
+    }
+    return SIZE_MAX;
+  }
+
+  template<typename T>
+  inline bool isInSet_scalar(const T x, const T *set, const size_t setLen)
+  {
+    for(size_t i = 0; i < setLen; i++) {
+      if( x == set[i] ) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template<typename T>
+  uint64_t matchSet_scalar(const T *s, const size_t len, const T *set, const size_t setLen)
+  {
+    const size_t count = csMin<size_t>(len, 64);
+
+    uint64_t mask = 0;
+    for(size_t i = 0; i < count; i++) {
+      if( isInSet_scalar(s[i], set, setLen) ) {
+        mask |= uint64_t(1) << i;
+      }
+    }
+
+    return mask;
+  }
+
+  template<typename T, bool NEGATE>
+  size_t findFirstOf_scalar(const T *s, const size_t len, const T *set, const size_t setLen)
+  {
+    for(size_t i = 0; i < len; i++) {
+      if( isInSet_scalar(s[i], set, setLen) != NEGATE ) {
+        return i;
+      }
+    }
+    return SIZE_MAX;
+  }
+
+  template<typename T, bool UPPER>
+  void mapCase_scalar(T *s, const size_t len)
+  {
+    for(size_t i = 0; i < len; i++) {
+      s[i] = UPPER
+          ? toUpper_scalar(s[i])
+          : toLower_scalar(s[i]);
+    }
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  void replaceChar_scalar(T *s, const size_t len, const T before, const T after)
+  {
+    const T needle = fold_scalar<T,IGNORE_CASE>(before);
+    for(size_t i = 0; i < len; i++) {
+      if( fold_scalar<T,IGNORE_CASE>(s[i]) == needle ) {
+        s[i] = after;
+      }
+    }
+  }
+
+  template<typename T>
+  uint64_t matchSetBlock_scalar(const T *s, const T *set, const size_t setLen)
+  {
+    return matchSet_scalar(s, 64, set, setLen);
+  }
+
+  // Sets up to this size are broadcast into vector registers
+  const size_t MAX_VECTOR_SET = 16;
+
+#ifdef CS_ARCH_X86
+
+  ////// SSE2 ////////////////////////////////////////////////////////////////
+
+  template<typename T>
+  CS_TARGET_SSE2 inline __m128i set1_sse2(const T x)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm_set1_epi8(char(x));
+    } else if( sizeof(T) == 2 ) {
+      return _mm_set1_epi16(short(x));
+    }
+    return _mm_set1_epi32(int(x));
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 inline __m128i add_sse2(const __m128i a, const __m128i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm_add_epi8(a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm_add_epi16(a, b);
+    }
+    return _mm_add_epi32(a, b);
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 inline __m128i cmpeq_sse2(const __m128i a, const __m128i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm_cmpeq_epi8(a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm_cmpeq_epi16(a, b);
+    }
+    return _mm_cmpeq_epi32(a, b);
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 inline __m128i cmplt_sse2(const __m128i a, const __m128i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm_cmplt_epi8(a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm_cmplt_epi16(a, b);
+    }
+    return _mm_cmplt_epi32(a, b);
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_SSE2 inline __m128i toCase_sse2(const __m128i x)
+  {
+    const T FIRST = UPPER  ?  T('a') : T('A');
+    const T DELTA = UPPER  ?  T(-0x20) : T(0x20);
+
+    // Unsigned range check (x - FIRST) < 26 using signed compares
+    const T       BIAS    = T(T(1) << (8*sizeof(T) - 1));
+    const __m128i t       = add_sse2<T>(x, set1_sse2<T>(T(BIAS - FIRST)));
+    const __m128i inRange = cmplt_sse2<T>(t, set1_sse2<T>(T(BIAS + T(26))));
+    return add_sse2<T>(x, _mm_and_si128(inRange, set1_sse2<T>(DELTA)));
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 inline __m128i toLower_sse2(const __m128i x)
+  {
+    return toCase_sse2<T,false>(x);
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 inline uint32_t zeroMask_sse2(const __m128i *p)
+  {
+    return uint32_t(_mm_movemask_epi8(cmpeq_sse2<T>(_mm_load_si128(p), _mm_setzero_si128())));
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 size_t findZero_sse2(const T *s, const size_t maxcount)
+  {
+    const size_t VEC_BYTES   = 16;
+    const size_t VEC_COUNT   = VEC_BYTES/sizeof(T);
+    const size_t BLOCK_BYTES = 4*VEC_BYTES;
+
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(s);
+    const size_t    skip = size_t(addr & (VEC_BYTES - 1));
+    const __m128i  *p    = reinterpret_cast<const __m128i*>(addr - skip);
+
+    // Byte mask; one bit per byte, starting at s
+    uint32_t mask = zeroMask_sse2<T>(p) >> skip;
+    if( mask != 0 ) {
+      return csMin(size_t(priv_cpu::ctz32(mask))/sizeof(T), maxcount);
+    }
+
+    // Single vectors up to a block boundary; blocks never cross pages
+    size_t count = (VEC_BYTES - skip)/sizeof(T);
+    while( count < maxcount  &&  (reinterpret_cast<uintptr_t>(p + 1) & (BLOCK_BYTES - 1)) != 0 ) {
+      mask = zeroMask_sse2<T>(++p);
+      if( mask != 0 ) {
+        return csMin(count + size_t(priv_cpu::ctz32(mask))/sizeof(T), maxcount);
+      }
+      count += VEC_COUNT;
+    }
+
+    // Blocks of four vectors; their masks are combined before branching
+    const __m128i zero = _mm_setzero_si128();
+    while( count < maxcount ) {
+      const __m128i z0 = cmpeq_sse2<T>(_mm_load_si128(p + 1), zero);
+      const __m128i z1 = cmpeq_sse2<T>(_mm_load_si128(p + 2), zero);
+      const __m128i z2 = cmpeq_sse2<T>(_mm_load_si128(p + 3), zero);
+      const __m128i z3 = cmpeq_sse2<T>(_mm_load_si128(p + 4), zero);
+      const __m128i any = _mm_or_si128(_mm_or_si128(z0, z1), _mm_or_si128(z2, z3));
+      if( _mm_movemask_epi8(any) != 0 ) {
+        const uint64_t lo =
+            uint64_t(_mm_movemask_epi8(z0))       | uint64_t(_mm_movemask_epi8(z1)) << 16 |
+            uint64_t(_mm_movemask_epi8(z2)) << 32 | uint64_t(_mm_movemask_epi8(z3)) << 48;
+        return csMin(count + size_t(priv_cpu::ctz64(lo))/sizeof(T), maxcount);
+      }
+      p     += 4;
+      count += 4*VEC_COUNT;
+    }
+
+    return maxcount;
+  }
+
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  CS_TARGET_SSE2 inline uint32_t mismatchMask_sse2(const T *s1, const T *s2)
+  {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s1));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s2));
+    const uint32_t zero = TERMINATED
+        ? uint32_t(_mm_movemask_epi8(cmpeq_sse2<T>(a, _mm_setzero_si128())))
+        : 0;
+    if( IGNORE_CASE ) {
+      a = toLower_sse2<T>(a);
+      b = toLower_sse2<T>(b);
+    }
+    const uint32_t equal = uint32_t(_mm_movemask_epi8(cmpeq_sse2<T>(a, b)));
+    return (~equal & 0xFFFF) | zero;
+  }
+
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  CS_TARGET_SSE2 size_t findMismatch_sse2(const T *s1, const T *s2, const size_t maxcount)
+  {
+    const size_t VEC_BYTES = 16;
+
+    size_t i = 0;
+    while( i < maxcount ) {
+      if( priv_cpu::isPageSafe(s1 + i, VEC_BYTES)  &&  priv_cpu::isPageSafe(s2 + i, VEC_BYTES) ) {
+        const uint32_t mask = mismatchMask_sse2<T,IGNORE_CASE,TERMINATED>(s1 + i, s2 + i);
+        if( mask != 0 ) {
+          return csMin(i + size_t(priv_cpu::ctz32(mask))/sizeof(T), maxcount);
+        }
+        i += VEC_BYTES/sizeof(T);
+      } else {
+        if( isMismatch_scalar<T,IGNORE_CASE,TERMINATED>(s1[i], s2[i]) ) {
+          return i;
+        }
+        i++;
+      }
+    }
+
+    return maxcount;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_SSE2 inline __m128i load_sse2(const T *p)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return IGNORE_CASE
+        ? toLower_sse2<T>(v)
+        : v;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_SSE2 size_t findSubstring_sse2(const T *hay, const size_t n, const T *needle, const size_t m)
+  {
+    const size_t VEC_COUNT = 16/sizeof(T);
+    const size_t ELEM_MASK = (size_t(1) << sizeof(T)) - 1;
+
+    const __m128i first = set1_sse2<T>(fold_scalar<T,IGNORE_CASE>(needle[0]));
+    const __m128i last  = set1_sse2<T>(fold_scalar<T,IGNORE_CASE>(needle[m - 1]));
+
+    size_t i = 0;
+    for(; i + m - 1 + VEC_COUNT <= n; i += VEC_COUNT) {
+      const __m128i eqFirst = cmpeq_sse2<T>(load_sse2<T,IGNORE_CASE>(hay + i), first);
+      const __m128i eqLast  = cmpeq_sse2<T>(load_sse2<T,IGNORE_CASE>(hay + i + m - 1), last);
+      uint32_t mask = uint32_t(_mm_movemask_epi8(_mm_and_si128(eqFirst, eqLast)));
+      while( mask != 0 ) {
+        const size_t bit = size_t(priv_cpu::ctz32(mask));
+        const size_t pos = i + bit/sizeof(T);
+        if( isEqual_scalar<T,IGNORE_CASE>(hay + pos + 1, needle + 1, m < 2  ?  0 : m - 2) ) {
+          return pos;
+        }
+        mask &= ~uint32_t(ELEM_MASK << bit);
+      }
+    }
+
+    const size_t tail = findSubstring_scalar<T,IGNORE_CASE>(hay + i, n - i, needle, m);
+    return tail != SIZE_MAX
+        ? i + tail
+        : SIZE_MAX;
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_SSE2 inline void mapCaseVector_sse2(T *p)
+  {
+    __m128i *v = reinterpret_cast<__m128i*>(p);
+    _mm_storeu_si128(v, toCase_sse2<T,UPPER>(_mm_loadu_si128(v)));
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_SSE2 void mapCase_sse2(T *s, const size_t len)
+  {
+    const size_t VEC_COUNT = 16/sizeof(T);
+
+    if( len < VEC_COUNT ) {
+      mapCase_scalar<T,UPPER>(s, len);
+      return;
+    }
+
+    for(size_t i = 0; i + VEC_COUNT <= len; i += VEC_COUNT) {
+      mapCaseVector_sse2<T,UPPER>(s + i);
+    }
+    // Case mapping is idempotent; overlap the last vector with the previous one
+    if( len % VEC_COUNT != 0 ) {
+      mapCaseVector_sse2<T,UPPER>(s + len - VEC_COUNT);
+    }
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_SSE2 inline void replaceCharVector_sse2(T *p, const __m128i needle, const __m128i after)
+  {
+    __m128i *v = reinterpret_cast<__m128i*>(p);
+    const __m128i x  = _mm_loadu_si128(v);
+    const __m128i eq = cmpeq_sse2<T>(IGNORE_CASE  ?  toLower_sse2<T>(x) : x, needle);
+    if( _mm_movemask_epi8(eq) != 0 ) {
+      _mm_storeu_si128(v, _mm_or_si128(_mm_and_si128(eq, after), _mm_andnot_si128(eq, x)));
+    }
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_SSE2 void replaceChar_sse2(T *s, const size_t len, const T before, const T after)
+  {
+    const size_t VEC_COUNT = 16/sizeof(T);
+
+    if( len < VEC_COUNT ) {
+      replaceChar_scalar<T,IGNORE_CASE>(s, len, before, after);
+      return;
+    }
+
+    const __m128i needle = set1_sse2<T>(fold_scalar<T,IGNORE_CASE>(before));
+    const __m128i with   = set1_sse2<T>(after);
+    for(size_t i = 0; i + VEC_COUNT <= len; i += VEC_COUNT) {
+      replaceCharVector_sse2<T,IGNORE_CASE>(s + i, needle, with);
+    }
+    // Replacing is idempotent; overlap the last vector with the previous one
+    if( len % VEC_COUNT != 0 ) {
+      replaceCharVector_sse2<T,IGNORE_CASE>(s + len - VEC_COUNT, needle, with);
+    }
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 inline __m128i inSet_sse2(const T *p, const __m128i *set, const size_t setLen)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i hit = _mm_setzero_si128();
+    for(size_t i = 0; i < setLen; i++) {
+      hit = _mm_or_si128(hit, cmpeq_sse2<T>(v, set[i]));
+    }
+    return hit;
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 inline uint32_t matchSet16_sse2(const T *s, const __m128i *set, const size_t setLen)
+  {
+    // Saturated packing narrows the 0/-1 elements to one byte per element
+    if(        sizeof(T) == 1 ) {
+      return uint32_t(_mm_movemask_epi8(inSet_sse2<T>(s, set, setLen)));
+    } else if( sizeof(T) == 2 ) {
+      return uint32_t(_mm_movemask_epi8(_mm_packs_epi16(inSet_sse2<T>(s, set, setLen),
+                                                        inSet_sse2<T>(s + 8, set, setLen))));
+    }
+    const __m128i lo = _mm_packs_epi32(inSet_sse2<T>(s, set, setLen),
+                                       inSet_sse2<T>(s + 4, set, setLen));
+    const __m128i hi = _mm_packs_epi32(inSet_sse2<T>(s + 8, set, setLen),
+                                       inSet_sse2<T>(s + 12, set, setLen));
+    return uint32_t(_mm_movemask_epi8(_mm_packs_epi16(lo, hi)));
+  }
+
+  template<typename T>
+  CS_TARGET_SSE2 uint64_t matchSetBlock_sse2(const T *s, const T *set, const size_t setLen)
+  {
+    __m128i chars[MAX_VECTOR_SET];
+    for(size_t i = 0; i < setLen; i++) {
+      chars[i] = set1_sse2<T>(set[i]);
+    }
+
+    uint64_t mask = 0;
+    for(size_t i = 0; i < 64; i += 16) {
+      mask |= uint64_t(matchSet16_sse2<T>(s + i, chars, setLen)) << i;
+    }
+
+    return mask;
+  }
+
+  ////// AVX2 ////////////////////////////////////////////////////////////////
+
+  template<typename T>
+  CS_TARGET_AVX2 inline __m256i set1_avx2(const T x)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm256_set1_epi8(char(x));
+    } else if( sizeof(T) == 2 ) {
+      return _mm256_set1_epi16(short(x));
+    }
+    return _mm256_set1_epi32(int(x));
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline __m256i add_avx2(const __m256i a, const __m256i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm256_add_epi8(a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm256_add_epi16(a, b);
+    }
+    return _mm256_add_epi32(a, b);
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline __m256i cmpeq_avx2(const __m256i a, const __m256i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm256_cmpeq_epi8(a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm256_cmpeq_epi16(a, b);
+    }
+    return _mm256_cmpeq_epi32(a, b);
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline __m256i min_avx2(const __m256i a, const __m256i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm256_min_epu8(a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm256_min_epu16(a, b);
+    }
+    return _mm256_min_epu32(a, b);
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline __m256i cmpgt_avx2(const __m256i a, const __m256i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm256_cmpgt_epi8(a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm256_cmpgt_epi16(a, b);
+    }
+    return _mm256_cmpgt_epi32(a, b);
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_AVX2 inline __m256i toCase_avx2(const __m256i x)
+  {
+    const T FIRST = UPPER  ?  T('a') : T('A');
+    const T DELTA = UPPER  ?  T(-0x20) : T(0x20);
+
+    // Unsigned range check (x - FIRST) < 26 using signed compares
+    const T       BIAS    = T(T(1) << (8*sizeof(T) - 1));
+    const __m256i t       = add_avx2<T>(x, set1_avx2<T>(T(BIAS - FIRST)));
+    const __m256i inRange = cmpgt_avx2<T>(set1_avx2<T>(T(BIAS + T(26))), t);
+    return add_avx2<T>(x, _mm256_and_si256(inRange, set1_avx2<T>(DELTA)));
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline __m256i toLower_avx2(const __m256i x)
+  {
+    return toCase_avx2<T,false>(x);
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline uint32_t zeroMask_avx2(const __m256i *p)
+  {
+    return uint32_t(_mm256_movemask_epi8(cmpeq_avx2<T>(_mm256_load_si256(p), _mm256_setzero_si256())));
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 size_t findZero_avx2(const T *s, const size_t maxcount)
+  {
+    const size_t VEC_BYTES   = 32;
+    const size_t VEC_COUNT   = VEC_BYTES/sizeof(T);
+    const size_t BLOCK_BYTES = 4*VEC_BYTES;
+
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(s);
+    const size_t    skip = size_t(addr & (VEC_BYTES - 1));
+    const __m256i  *p    = reinterpret_cast<const __m256i*>(addr - skip);
+
+    // Byte mask; one bit per byte, starting at s
+    uint32_t mask = zeroMask_avx2<T>(p) >> skip;
+    if( mask != 0 ) {
+      return csMin(size_t(priv_cpu::ctz32(mask))/sizeof(T), maxcount);
+    }
+
+    // Single vectors up to a block boundary; blocks never cross pages
+    size_t count = (VEC_BYTES - skip)/sizeof(T);
+    while( count < maxcount  &&  (reinterpret_cast<uintptr_t>(p + 1) & (BLOCK_BYTES - 1)) != 0 ) {
+      mask = zeroMask_avx2<T>(++p);
+      if( mask != 0 ) {
+        return csMin(count + size_t(priv_cpu::ctz32(mask))/sizeof(T), maxcount);
+      }
+      count += VEC_COUNT;
+    }
+
+    // Blocks of four vectors; a zero element is their minimum
+    const __m256i zero = _mm256_setzero_si256();
+    while( count < maxcount ) {
+      const __m256i v0 = _mm256_load_si256(p + 1);
+      const __m256i v1 = _mm256_load_si256(p + 2);
+      const __m256i v2 = _mm256_load_si256(p + 3);
+      const __m256i v3 = _mm256_load_si256(p + 4);
+      const __m256i least = min_avx2<T>(min_avx2<T>(v0, v1), min_avx2<T>(v2, v3));
+      if( _mm256_movemask_epi8(cmpeq_avx2<T>(least, zero)) != 0 ) {
+        const uint64_t lo =
+            uint64_t(uint32_t(_mm256_movemask_epi8(cmpeq_avx2<T>(v0, zero)))) |
+            uint64_t(uint32_t(_mm256_movemask_epi8(cmpeq_avx2<T>(v1, zero)))) << 32;
+        if( lo != 0 ) {
+          return csMin(count + size_t(priv_cpu::ctz64(lo))/sizeof(T), maxcount);
+        }
+        const uint64_t hi =
+            uint64_t(uint32_t(_mm256_movemask_epi8(cmpeq_avx2<T>(v2, zero)))) |
+            uint64_t(uint32_t(_mm256_movemask_epi8(cmpeq_avx2<T>(v3, zero)))) << 32;
+        return csMin(count + 2*VEC_COUNT + size_t(priv_cpu::ctz64(hi))/sizeof(T), maxcount);
+      }
+      p     += 4;
+      count += 4*VEC_COUNT;
+    }
+
+    return maxcount;
+  }
+
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  CS_TARGET_AVX2 inline uint32_t mismatchMask_avx2(const T *s1, const T *s2)
+  {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s1));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s2));
+    const uint32_t zero = TERMINATED
+        ? uint32_t(_mm256_movemask_epi8(cmpeq_avx2<T>(a, _mm256_setzero_si256())))
+        : 0;
+    if( IGNORE_CASE ) {
+      a = toLower_avx2<T>(a);
+      b = toLower_avx2<T>(b);
+    }
+    const uint32_t equal = uint32_t(_mm256_movemask_epi8(cmpeq_avx2<T>(a, b)));
+    return ~equal | zero;
+  }
+
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  CS_TARGET_AVX2 size_t findMismatch_avx2(const T *s1, const T *s2, const size_t maxcount)
+  {
+    const size_t VEC_BYTES = 32;
+
+    size_t i = 0;
+    while( i < maxcount ) {
+      if( priv_cpu::isPageSafe(s1 + i, VEC_BYTES)  &&  priv_cpu::isPageSafe(s2 + i, VEC_BYTES) ) {
+        const uint32_t mask = mismatchMask_avx2<T,IGNORE_CASE,TERMINATED>(s1 + i, s2 + i);
+        if( mask != 0 ) {
+          return csMin(i + size_t(priv_cpu::ctz32(mask))/sizeof(T), maxcount);
+        }
+        i += VEC_BYTES/sizeof(T);
+      } else {
+        if( isMismatch_scalar<T,IGNORE_CASE,TERMINATED>(s1[i], s2[i]) ) {
+          return i;
+        }
+        i++;
+      }
+    }
+
+    return maxcount;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX2 inline __m256i load_avx2(const T *p)
+  {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    return IGNORE_CASE
+        ? toLower_avx2<T>(v)
+        : v;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX2 size_t findSubstring_avx2(const T *hay, const size_t n, const T *needle, const size_t m)
+  {
+    const size_t VEC_COUNT = 32/sizeof(T);
+    const size_t ELEM_MASK = (size_t(1) << sizeof(T)) - 1;
+
+    const __m256i first = set1_avx2<T>(fold_scalar<T,IGNORE_CASE>(needle[0]));
+    const __m256i last  = set1_avx2<T>(fold_scalar<T,IGNORE_CASE>(needle[m - 1]));
+
+    size_t i = 0;
+    for(; i + m - 1 + VEC_COUNT <= n; i += VEC_COUNT) {
+      const __m256i eqFirst = cmpeq_avx2<T>(load_avx2<T,IGNORE_CASE>(hay + i), first);
+      const __m256i eqLast  = cmpeq_avx2<T>(load_avx2<T,IGNORE_CASE>(hay + i + m - 1), last);
+      uint32_t mask = uint32_t(_mm256_movemask_epi8(_mm256_and_si256(eqFirst, eqLast)));
+      while( mask != 0 ) {
+        const size_t bit = size_t(priv_cpu::ctz32(mask));
+        const size_t pos = i + bit/sizeof(T);
+        if( isEqual_scalar<T,IGNORE_CASE>(hay + pos + 1, needle + 1, m < 2  ?  0 : m - 2) ) {
+          return pos;
+        }
+        mask &= ~uint32_t(ELEM_MASK << bit);
+      }
+    }
+
+    const size_t tail = findSubstring_scalar<T,IGNORE_CASE>(hay + i, n - i, needle, m);
+    return tail != SIZE_MAX
+        ? i + tail
+        : SIZE_MAX;
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_AVX2 inline void mapCaseVector_avx2(T *p)
+  {
+    __m256i *v = reinterpret_cast<__m256i*>(p);
+    _mm256_storeu_si256(v, toCase_avx2<T,UPPER>(_mm256_loadu_si256(v)));
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_AVX2 void mapCase_avx2(T *s, const size_t len)
+  {
+    const size_t VEC_COUNT = 32/sizeof(T);
+
+    if( len < VEC_COUNT ) {
+      mapCase_scalar<T,UPPER>(s, len);
+      return;
+    }
+
+    for(size_t i = 0; i + VEC_COUNT <= len; i += VEC_COUNT) {
+      mapCaseVector_avx2<T,UPPER>(s + i);
+    }
+    // Case mapping is idempotent; overlap the last vector with the previous one
+    if( len % VEC_COUNT != 0 ) {
+      mapCaseVector_avx2<T,UPPER>(s + len - VEC_COUNT);
+    }
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX2 inline void replaceCharVector_avx2(T *p, const __m256i needle, const __m256i after)
+  {
+    __m256i *v = reinterpret_cast<__m256i*>(p);
+    const __m256i x  = _mm256_loadu_si256(v);
+    const __m256i eq = cmpeq_avx2<T>(IGNORE_CASE  ?  toLower_avx2<T>(x) : x, needle);
+    if( _mm256_movemask_epi8(eq) != 0 ) {
+      _mm256_storeu_si256(v, _mm256_blendv_epi8(x, after, eq));
+    }
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX2 void replaceChar_avx2(T *s, const size_t len, const T before, const T after)
+  {
+    const size_t VEC_COUNT = 32/sizeof(T);
+
+    if( len < VEC_COUNT ) {
+      replaceChar_scalar<T,IGNORE_CASE>(s, len, before, after);
+      return;
+    }
+
+    const __m256i needle = set1_avx2<T>(fold_scalar<T,IGNORE_CASE>(before));
+    const __m256i with   = set1_avx2<T>(after);
+    for(size_t i = 0; i + VEC_COUNT <= len; i += VEC_COUNT) {
+      replaceCharVector_avx2<T,IGNORE_CASE>(s + i, needle, with);
+    }
+    // Replacing is idempotent; overlap the last vector with the previous one
+    if( len % VEC_COUNT != 0 ) {
+      replaceCharVector_avx2<T,IGNORE_CASE>(s + len - VEC_COUNT, needle, with);
+    }
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline __m256i inSet_avx2(const T *p, const __m256i *set, const size_t setLen)
+  {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i hit = _mm256_setzero_si256();
+    for(size_t i = 0; i < setLen; i++) {
+      hit = _mm256_or_si256(hit, cmpeq_avx2<T>(v, set[i]));
+    }
+    return hit;
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 inline uint32_t matchSet32_avx2(const T *s, const __m256i *set, const size_t setLen)
+  {
+    // Packing operates per 128-bit lane; permute the results back into order
+    if(        sizeof(T) == 1 ) {
+      return uint32_t(_mm256_movemask_epi8(inSet_avx2<T>(s, set, setLen)));
+    } else if( sizeof(T) == 2 ) {
+      const __m256i packed = _mm256_packs_epi16(inSet_avx2<T>(s, set, setLen),
+                                                inSet_avx2<T>(s + 16, set, setLen));
+      return uint32_t(_mm256_movemask_epi8(_mm256_permute4x64_epi64(packed, 0xD8)));
+    }
+    const __m256i lo = _mm256_packs_epi32(inSet_avx2<T>(s, set, setLen),
+                                          inSet_avx2<T>(s + 8, set, setLen));
+    const __m256i hi = _mm256_packs_epi32(inSet_avx2<T>(s + 16, set, setLen),
+                                          inSet_avx2<T>(s + 24, set, setLen));
+    const __m256i packed = _mm256_packs_epi16(lo, hi);
+    return uint32_t(_mm256_movemask_epi8(_mm256_permutevar8x32_epi32(packed,
+                                                                     _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7))));
+  }
+
+  template<typename T>
+  CS_TARGET_AVX2 uint64_t matchSetBlock_avx2(const T *s, const T *set, const size_t setLen)
+  {
+    __m256i chars[MAX_VECTOR_SET];
+    for(size_t i = 0; i < setLen; i++) {
+      chars[i] = set1_avx2<T>(set[i]);
+    }
+
+    const uint64_t lo = matchSet32_avx2<T>(s, chars, setLen);
+    const uint64_t hi = matchSet32_avx2<T>(s + 32, chars, setLen);
+    return lo | (hi << 32);
+  }
+
+  ////// AVX-512 /////////////////////////////////////////////////////////////
+
+  template<typename T>
+  CS_TARGET_AVX512 inline __m512i set1_avx512(const T x)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm512_set1_epi8(char(x));
+    } else if( sizeof(T) == 2 ) {
+      return _mm512_set1_epi16(short(x));
+    }
+    return _mm512_set1_epi32(int(x));
+  }
+
+  template<typename T>
+  CS_TARGET_AVX512 inline uint64_t zeroMask_avx512(const __m512i v)
+  {
+    if(        sizeof(T) == 1 ) {
+      return uint64_t(_mm512_testn_epi8_mask(v, v));
+    } else if( sizeof(T) == 2 ) {
+      return uint64_t(_mm512_testn_epi16_mask(v, v));
+    }
+    return uint64_t(_mm512_testn_epi32_mask(v, v));
+  }
+
+  template<typename T>
+  CS_TARGET_AVX512 inline uint64_t cmpneq_avx512(const __m512i a, const __m512i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return uint64_t(_mm512_cmpneq_epi8_mask(a, b));
+    } else if( sizeof(T) == 2 ) {
+      return uint64_t(_mm512_cmpneq_epi16_mask(a, b));
+    }
+    return uint64_t(_mm512_cmpneq_epi32_mask(a, b));
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_AVX512 inline __m512i toCase_avx512(const __m512i x)
+  {
+    const __m512i FIRST = set1_avx512<T>(UPPER  ?  T('a') : T('A'));
+    const __m512i N     = set1_avx512<T>(T(26));
+    const __m512i DELTA = set1_avx512<T>(UPPER  ?  T(-0x20) : T(0x20));
+    if(        sizeof(T) == 1 ) {
+      const __mmask64 inRange = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(x, FIRST), N);
+      return _mm512_mask_add_epi8(x, inRange, x, DELTA);
+    } else if( sizeof(T) == 2 ) {
+      const __mmask32 inRange = _mm512_cmplt_epu16_mask(_mm512_sub_epi16(x, FIRST), N);
+      return _mm512_mask_add_epi16(x, inRange, x, DELTA);
+    }
+    const __mmask16 inRange = _mm512_cmplt_epu32_mask(_mm512_sub_epi32(x, FIRST), N);
+    return _mm512_mask_add_epi32(x, inRange, x, DELTA);
+  }
+
+  template<typename T>
+  CS_TARGET_AVX512 inline __m512i toLower_avx512(const __m512i x)
+  {
+    return toCase_avx512<T,false>(x);
+  }
+
+  template<typename T>
+  CS_TARGET_AVX512 size_t findZero_avx512(const T *s, const size_t maxcount)
+  {
+    const size_t VEC_BYTES   = 64;
+    const size_t VEC_COUNT   = VEC_BYTES/sizeof(T);
+    const size_t BLOCK_BYTES = 4*VEC_BYTES;
+
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(s);
+    const size_t    skip = size_t(addr & (VEC_BYTES - 1));
+    const __m512i  *p    = reinterpret_cast<const __m512i*>(addr - skip);
+
+    // Element mask; one bit per element, starting at s
+    uint64_t mask = zeroMask_avx512<T>(_mm512_load_si512(p)) >> (skip/sizeof(T));
+    if( mask != 0 ) {
+      return csMin(size_t(priv_cpu::ctz64(mask)), maxcount);
+    }
+
+    // Single vectors up to a block boundary; blocks never cross pages
+    size_t count = (VEC_BYTES - skip)/sizeof(T);
+    while( count < maxcount  &&  (reinterpret_cast<uintptr_t>(p + 1) & (BLOCK_BYTES - 1)) != 0 ) {
+      mask = zeroMask_avx512<T>(_mm512_load_si512(++p));
+      if( mask != 0 ) {
+        return csMin(count + size_t(priv_cpu::ctz64(mask)), maxcount);
+      }
+      count += VEC_COUNT;
+    }
+
+    // Blocks of four vectors; their masks are combined before branching
+    while( count < maxcount ) {
+      const uint64_t m0 = zeroMask_avx512<T>(_mm512_load_si512(p + 1));
+      const uint64_t m1 = zeroMask_avx512<T>(_mm512_load_si512(p + 2));
+      const uint64_t m2 = zeroMask_avx512<T>(_mm512_load_si512(p + 3));
+      const uint64_t m3 = zeroMask_avx512<T>(_mm512_load_si512(p + 4));
+      if( (m0 | m1 | m2 | m3) != 0 ) {
+        const size_t index =
+              m0 != 0  ?  size_t(priv_cpu::ctz64(m0))
+            : m1 != 0  ?  size_t(priv_cpu::ctz64(m1)) +   VEC_COUNT
+            : m2 != 0  ?  size_t(priv_cpu::ctz64(m2)) + 2*VEC_COUNT
+            :             size_t(priv_cpu::ctz64(m3)) + 3*VEC_COUNT;
+        return csMin(count + index, maxcount);
+      }
+      p     += 4;
+      count += 4*VEC_COUNT;
+    }
+
+    return maxcount;
+  }
+
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  CS_TARGET_AVX512 inline uint64_t mismatchMask_avx512(const T *s1, const T *s2)
+  {
+    __m512i a = _mm512_loadu_si512(s1);
+    __m512i b = _mm512_loadu_si512(s2);
+    const uint64_t zero = TERMINATED
+        ? zeroMask_avx512<T>(a)
+        : 0;
+    if( IGNORE_CASE ) {
+      a = toLower_avx512<T>(a);
+      b = toLower_avx512<T>(b);
+    }
+    return cmpneq_avx512<T>(a, b) | zero;
+  }
+
+  template<typename T, bool IGNORE_CASE, bool TERMINATED>
+  CS_TARGET_AVX512 size_t findMismatch_avx512(const T *s1, const T *s2, const size_t maxcount)
+  {
+    const size_t VEC_BYTES = 64;
+
+    size_t i = 0;
+    while( i < maxcount ) {
+      if( priv_cpu::isPageSafe(s1 + i, VEC_BYTES)  &&  priv_cpu::isPageSafe(s2 + i, VEC_BYTES) ) {
+        const uint64_t mask = mismatchMask_avx512<T,IGNORE_CASE,TERMINATED>(s1 + i, s2 + i);
+        if( mask != 0 ) {
+          return csMin(i + size_t(priv_cpu::ctz64(mask)), maxcount);
+        }
+        i += VEC_BYTES/sizeof(T);
+      } else {
+        if( isMismatch_scalar<T,IGNORE_CASE,TERMINATED>(s1[i], s2[i]) ) {
+          return i;
+        }
+        i++;
+      }
+    }
+
+    return maxcount;
+  }
+
+  template<typename T>
+  CS_TARGET_AVX512 inline uint64_t cmpeq_avx512(const __m512i a, const __m512i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return uint64_t(_mm512_cmpeq_epi8_mask(a, b));
+    } else if( sizeof(T) == 2 ) {
+      return uint64_t(_mm512_cmpeq_epi16_mask(a, b));
+    }
+    return uint64_t(_mm512_cmpeq_epi32_mask(a, b));
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX512 inline __m512i load_avx512(const T *p)
+  {
+    const __m512i v = _mm512_loadu_si512(p);
+    return IGNORE_CASE
+        ? toLower_avx512<T>(v)
+        : v;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX512 size_t findSubstring_avx512(const T *hay, const size_t n, const T *needle, const size_t m)
+  {
+    const size_t VEC_COUNT = 64/sizeof(T);
+
+    const __m512i first = set1_avx512<T>(fold_scalar<T,IGNORE_CASE>(needle[0]));
+    const __m512i last  = set1_avx512<T>(fold_scalar<T,IGNORE_CASE>(needle[m - 1]));
+
+    size_t i = 0;
+    for(; i + m - 1 + VEC_COUNT <= n; i += VEC_COUNT) {
+      uint64_t mask =
+          cmpeq_avx512<T>(load_avx512<T,IGNORE_CASE>(hay + i), first) &
+          cmpeq_avx512<T>(load_avx512<T,IGNORE_CASE>(hay + i + m - 1), last);
+      while( mask != 0 ) {
+        const size_t pos = i + size_t(priv_cpu::ctz64(mask));
+        if( isEqual_scalar<T,IGNORE_CASE>(hay + pos + 1, needle + 1, m < 2  ?  0 : m - 2) ) {
+          return pos;
+        }
+        mask &= mask - 1;
+      }
+    }
+
+    const size_t tail = findSubstring_scalar<T,IGNORE_CASE>(hay + i, n - i, needle, m);
+    return tail != SIZE_MAX
+        ? i + tail
+        : SIZE_MAX;
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_AVX512 inline void mapCaseVector_avx512(T *p)
+  {
+    _mm512_storeu_si512(p, toCase_avx512<T,UPPER>(_mm512_loadu_si512(p)));
+  }
+
+  template<typename T, bool UPPER>
+  CS_TARGET_AVX512 void mapCase_avx512(T *s, const size_t len)
+  {
+    const size_t VEC_COUNT = 64/sizeof(T);
+
+    if( len < VEC_COUNT ) {
+      mapCase_scalar<T,UPPER>(s, len);
+      return;
+    }
+
+    for(size_t i = 0; i + VEC_COUNT <= len; i += VEC_COUNT) {
+      mapCaseVector_avx512<T,UPPER>(s + i);
+    }
+    // Case mapping is idempotent; overlap the last vector with the previous one
+    if( len % VEC_COUNT != 0 ) {
+      mapCaseVector_avx512<T,UPPER>(s + len - VEC_COUNT);
+    }
+  }
+
+  template<typename T>
+  CS_TARGET_AVX512 inline __m512i blend_avx512(const uint64_t mask, const __m512i a, const __m512i b)
+  {
+    if(        sizeof(T) == 1 ) {
+      return _mm512_mask_blend_epi8(__mmask64(mask), a, b);
+    } else if( sizeof(T) == 2 ) {
+      return _mm512_mask_blend_epi16(__mmask32(mask), a, b);
+    }
+    return _mm512_mask_blend_epi32(__mmask16(mask), a, b);
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX512 inline void replaceCharVector_avx512(T *p, const __m512i needle, const __m512i after)
+  {
+    const __m512i  x  = _mm512_loadu_si512(p);
+    const uint64_t eq = cmpeq_avx512<T>(IGNORE_CASE  ?  toLower_avx512<T>(x) : x, needle);
+    if( eq != 0 ) {
+      _mm512_storeu_si512(p, blend_avx512<T>(eq, x, after));
+    }
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  CS_TARGET_AVX512 void replaceChar_avx512(T *s, const size_t len, const T before, const T after)
+  {
+    const size_t VEC_COUNT = 64/sizeof(T);
+
+    if( len < VEC_COUNT ) {
+      replaceChar_scalar<T,IGNORE_CASE>(s, len, before, after);
+      return;
+    }
+
+    const __m512i needle = set1_avx512<T>(fold_scalar<T,IGNORE_CASE>(before));
+    const __m512i with   = set1_avx512<T>(after);
+    for(size_t i = 0; i + VEC_COUNT <= len; i += VEC_COUNT) {
+      replaceCharVector_avx512<T,IGNORE_CASE>(s + i, needle, with);
+    }
+    // Replacing is idempotent; overlap the last vector with the previous one
+    if( len % VEC_COUNT != 0 ) {
+      replaceCharVector_avx512<T,IGNORE_CASE>(s + len - VEC_COUNT, needle, with);
+    }
+  }
+
+  template<typename T>
+  CS_TARGET_AVX512 uint64_t matchSetBlock_avx512(const T *s, const T *set, const size_t setLen)
+  {
+    const size_t VEC_COUNT = 64/sizeof(T);
+
+    __m512i chars[MAX_VECTOR_SET];
+    for(size_t i = 0; i < setLen; i++) {
+      chars[i] = set1_avx512<T>(set[i]);
+    }
+
+    uint64_t mask = 0;
+    for(size_t i = 0; i < 64; i += VEC_COUNT) {
+      const __m512i v = _mm512_loadu_si512(s + i);
+      uint64_t hit = 0;
+      for(size_t j = 0; j < setLen; j++) {
+        hit |= cmpeq_avx512<T>(v, chars[j]);
+      }
+      mask |= hit << i;
+    }
+
+    return mask;
+  }
+
+#endif // CS_ARCH_X86
+
+  ////// Dispatch ////////////////////////////////////////////////////////////
+
+  template<typename T>
+  struct Kernels {
+    typedef size_t (*findZero_func)(const T*, const size_t);
+    typedef size_t (*findMismatch_func)(const T*, const T*, const size_t);
+    typedef size_t (*findSubstring_func)(const T*, const size_t, const T*, const size_t);
+    typedef uint64_t (*matchSetBlock_func)(const T*, const T*, const size_t);
+    typedef void (*mapCase_func)(T*, const size_t);
+    typedef void (*replaceChar_func)(T*, const size_t, const T, const T);
+
+    Kernels()
+      : findZero(findZero_scalar<T>)
+      , findMismatch(findMismatch_scalar<T,false,true>)
+      , findMismatchI(findMismatch_scalar<T,true,true>)
+      , findDifference(findMismatch_scalar<T,false,false>)
+      , findDifferenceI(findMismatch_scalar<T,true,false>)
+      , findSubstring(findSubstring_scalar<T,false>)
+      , findSubstringI(findSubstring_scalar<T,true>)
+      , matchSetBlock(matchSetBlock_scalar<T>)
+      , mapLower(mapCase_scalar<T,false>)
+      , mapUpper(mapCase_scalar<T,true>)
+      , replaceChar(replaceChar_scalar<T,false>)
+      , replaceCharI(replaceChar_scalar<T,true>)
+    {
+#ifdef CS_ARCH_X86
+      const priv_cpu::Level level = priv_cpu::level();
+      if(        level >= priv_cpu::AVX512 ) {
+        findZero      = findZero_avx512<T>;
+        findMismatch    = findMismatch_avx512<T,false,true>;
+        findMismatchI   = findMismatch_avx512<T,true,true>;
+        findDifference  = findMismatch_avx512<T,false,false>;
+        findDifferenceI = findMismatch_avx512<T,true,false>;
+
+        findSubstring  = findSubstring_avx512<T,false>;
+        findSubstringI = findSubstring_avx512<T,true>;
+
+        matchSetBlock = matchSetBlock_avx512<T>;
+
+        mapLower = mapCase_avx512<T,false>;
+        mapUpper = mapCase_avx512<T,true>;
+
+        replaceChar  = replaceChar_avx512<T,false>;
+        replaceCharI = replaceChar_avx512<T,true>;
+      } else if( level >= priv_cpu::AVX2 ) {
+        findZero      = findZero_avx2<T>;
+        findMismatch    = findMismatch_avx2<T,false,true>;
+        findMismatchI   = findMismatch_avx2<T,true,true>;
+        findDifference  = findMismatch_avx2<T,false,false>;
+        findDifferenceI = findMismatch_avx2<T,true,false>;
+
+        findSubstring  = findSubstring_avx2<T,false>;
+        findSubstringI = findSubstring_avx2<T,true>;
+
+        matchSetBlock = matchSetBlock_avx2<T>;
+
+        mapLower = mapCase_avx2<T,false>;
+        mapUpper = mapCase_avx2<T,true>;
+
+        replaceChar  = replaceChar_avx2<T,false>;
+        replaceCharI = replaceChar_avx2<T,true>;
+      } else if( level >= priv_cpu::SSE2 ) {
+        findZero      = findZero_sse2<T>;
+        findMismatch    = findMismatch_sse2<T,false,true>;
+        findMismatchI   = findMismatch_sse2<T,true,true>;
+        findDifference  = findMismatch_sse2<T,false,false>;
+        findDifferenceI = findMismatch_sse2<T,true,false>;
+
+        findSubstring  = findSubstring_sse2<T,false>;
+        findSubstringI = findSubstring_sse2<T,true>;
+
+        matchSetBlock = matchSetBlock_sse2<T>;
+
+        mapLower = mapCase_sse2<T,false>;
+        mapUpper = mapCase_sse2<T,true>;
+
+        replaceChar  = replaceChar_sse2<T,false>;
+        replaceCharI = replaceChar_sse2<T,true>;
+      }
+#endif
+    }
+
+    static const Kernels<T>& get()
+    {
+      static const Kernels<T> kernels;
+      return kernels;
+    }
+
+    findZero_func findZero;
+
+    findMismatch_func findMismatch;
+    findMismatch_func findMismatchI;
+    findMismatch_func findDifference;
+    findMismatch_func findDifferenceI;
+
+    findSubstring_func findSubstring;
+    findSubstring_func findSubstringI;
+
+    matchSetBlock_func matchSetBlock;
+
+    mapCase_func mapLower;
+    mapCase_func mapUpper;
+
+    replaceChar_func replaceChar;
+    replaceChar_func replaceCharI;
+  };
+
+  template<typename T>
+  inline size_t findZero_dispatch(const T *s, const size_t maxcount)
+  {
+    if( maxcount < 1 ) {
+      return 0;
+    }
+    // Vector kernels require naturally aligned elements
+    if( (reinterpret_cast<uintptr_t>(s) & (sizeof(T) - 1)) != 0 ) {
+      return findZero_scalar(s, maxcount);
+    }
+    return Kernels<T>::get().findZero(s, maxcount);
+  }
+
+  template<typename T>
+  inline size_t findMismatch_dispatch(const T *s1, const T *s2, const size_t maxcount,
+                                      const bool ignoreCase)
+  {
+    const Kernels<T>& kernels = Kernels<T>::get();
+    return ignoreCase
+        ? kernels.findMismatchI(s1, s2, maxcount)
+        : kernels.findMismatch(s1, s2, maxcount);
+  }
+
+  template<typename T>
+  inline size_t findDifference_dispatch(const T *s1, const T *s2, const size_t len,
+                                        const bool ignoreCase)
+  {
+    const Kernels<T>& kernels = Kernels<T>::get();
+    return ignoreCase
+        ? kernels.findDifferenceI(s1, s2, len)
+        : kernels.findDifference(s1, s2, len);
+  }
+
+  template<typename T>
+  inline void replaceChar_dispatch(T *s, const size_t len, const T before, const T after,
+                                   const bool ignoreCase)
+  {
+    const Kernels<T>& kernels = Kernels<T>::get();
+    if( ignoreCase ) {
+      kernels.replaceCharI(s, len, before, after);
+    } else {
+      kernels.replaceChar(s, len, before, after);
+    }
+  }
+
+  template<typename T>
+  inline uint64_t matchSet_dispatch(const T *s, const size_t len,
+                                    const T *set, const size_t setLen)
+  {
+    if( len < 64  ||  setLen > MAX_VECTOR_SET ) {
+      return matchSet_scalar(s, len, set, setLen);
+    }
+    return Kernels<T>::get().matchSetBlock(s, set, setLen);
+  }
+
+  template<typename T, bool NEGATE>
+  inline size_t findFirstOf_dispatch(const T *s, const size_t len,
+                                     const T *set, const size_t setLen)
+  {
+    if( setLen > MAX_VECTOR_SET ) {
+      return findFirstOf_scalar<T,NEGATE>(s, len, set, setLen);
+    }
+
+    const Kernels<T>& kernels = Kernels<T>::get();
+
+    size_t i = 0;
+    for(; i + 64 <= len; i += 64) {
+      const uint64_t mask = NEGATE
+          ? ~kernels.matchSetBlock(s + i, set, setLen)
+          : kernels.matchSetBlock(s + i, set, setLen);
+      if( mask != 0 ) {
+        return i + size_t(priv_cpu::ctz64(mask));
+      }
+    }
+
+    // Short tails stop at the first hit
+    const size_t hit = findFirstOf_scalar<T,NEGATE>(s + i, len - i, set, setLen);
+    return hit != SIZE_MAX
+        ? i + hit
+        : SIZE_MAX;
+  }
+
+  // Needles up to this length are located by the vector kernels
+  const size_t SHORT_NEEDLE = 32;
+
+  template<typename T, bool IGNORE_CASE, template<typename> class SeqT>
+  size_t findTwoWay(const T *hay, const size_t n, const T *needle, const size_t m)
+  {
+    size_t result = SIZE_MAX;
+    priv_twoway::search<T,IGNORE_CASE>(SeqT<T>(hay, n), n, SeqT<T>(needle, m), m,
+                                       [&](const size_t j) -> bool {
+      result = j;
+      return false;
+    });
+    return result;
+  }
+
+  template<typename T, bool IGNORE_CASE>
+  size_t countTwoWay(const T *hay, const size_t n, const T *needle, const size_t m)
+  {
+    size_t count = 0;
+    priv_twoway::search<T,IGNORE_CASE>(priv_twoway::Forward<T>(hay, n), n,
+                                       priv_twoway::Forward<T>(needle, m), m,
+                                       [&](const size_t) -> bool {
+      count++;
+      return true;
+    });
+    return count;
+  }
+
+  template<typename T>
+  inline size_t findSubstring_dispatch(const T *hay, const size_t n,
+                                       const T *needle, const size_t m,
+                                       const bool ignoreCase)
+  {
+    if( m < 1  ||  m > n ) {
+      return SIZE_MAX;
+    }
+    if( m <= SHORT_NEEDLE ) {
+      const Kernels<T>& kernels = Kernels<T>::get();
+      return ignoreCase
+          ? kernels.findSubstringI(hay, n, needle, m)
+          : kernels.findSubstring(hay, n, needle, m);
+    }
+    return ignoreCase
+        ? findTwoWay<T,true,priv_twoway::Forward>(hay, n, needle, m)
+        : findTwoWay<T,false,priv_twoway::Forward>(hay, n, needle, m);
+  }
+
+  template<typename T>
+  inline size_t findLastSubstring_dispatch(const T *hay, const size_t n,
+                                           const T *needle, const size_t m,
+                                           const bool ignoreCase)
+  {
+    if( m < 1  ||  m > n ) {
+      return SIZE_MAX;
+    }
+    // Search the reversed needle in the reversed haystack
+    const size_t j = ignoreCase
+        ? findTwoWay<T,true,priv_twoway::Reverse>(hay, n, needle, m)
+        : findTwoWay<T,false,priv_twoway::Reverse>(hay, n, needle, m);
+    return j != SIZE_MAX
+        ? n - m - j
+        : SIZE_MAX;
+  }
+
+  template<typename T>
+  inline size_t countSubstring_dispatch(const T *hay, const size_t n,
+                                        const T *needle, const size_t m,
+                                        const bool ignoreCase)
+  {
+    if( m < 1  ||  m > n ) {
+      return 0;
+    }
+    if( m <= SHORT_NEEDLE ) {
+      size_t count = 0;
+      size_t pos   = 0;
+      size_t hit;
+      while( (hit = findSubstring_dispatch(hay + pos, n - pos, needle, m, ignoreCase)) != SIZE_MAX ) {
+        count++;
+        pos += hit + 1;
+      }
+      return count;
+    }
+    return ignoreCase
+        ? countTwoWay<T,true>(hay, n, needle, m)
+        : countTwoWay<T,false>(hay, n, needle, m);
+  }
+
+}; // namespace priv_simd
+
+////// Implementation ////////////////////////////////////////////////////////
+
+namespace priv_simd {
+
+  size_t countSubstring(const uint8_t *hay, const size_t hayLen,
+                        const uint8_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return countSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t countSubstring(const uint16_t *hay, const size_t hayLen,
+                        const uint16_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return countSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t countSubstring(const uint32_t *hay, const size_t hayLen,
+                        const uint32_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return countSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t findFirstNotOf(const uint8_t *s, const size_t len, const uint8_t *set, const size_t setLen)
+  {
+    return findFirstOf_dispatch<uint8_t,true>(s, len, set, setLen);
+  }
+
+  size_t findFirstNotOf(const uint16_t *s, const size_t len, const uint16_t *set, const size_t setLen)
+  {
+    return findFirstOf_dispatch<uint16_t,true>(s, len, set, setLen);
+  }
+
+  size_t findFirstNotOf(const uint32_t *s, const size_t len, const uint32_t *set, const size_t setLen)
+  {
+    return findFirstOf_dispatch<uint32_t,true>(s, len, set, setLen);
+  }
+
+  size_t findFirstOf(const uint8_t *s, const size_t len, const uint8_t *set, const size_t setLen)
+  {
+    return findFirstOf_dispatch<uint8_t,false>(s, len, set, setLen);
+  }
+
+  size_t findFirstOf(const uint16_t *s, const size_t len, const uint16_t *set, const size_t setLen)
+  {
+    return findFirstOf_dispatch<uint16_t,false>(s, len, set, setLen);
+  }
+
+  size_t findFirstOf(const uint32_t *s, const size_t len, const uint32_t *set, const size_t setLen)
+  {
+    return findFirstOf_dispatch<uint32_t,false>(s, len, set, setLen);
+  }
+
+  size_t findLastSubstring(const uint8_t *hay, const size_t hayLen,
+                           const uint8_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return findLastSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t findLastSubstring(const uint16_t *hay, const size_t hayLen,
+                           const uint16_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return findLastSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t findLastSubstring(const uint32_t *hay, const size_t hayLen,
+                           const uint32_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return findLastSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t findMismatch(const uint8_t *s1, const uint8_t *s2, const size_t maxcount,
+                      const bool ignoreCase)
+  {
+    return findMismatch_dispatch(s1, s2, maxcount, ignoreCase);
+  }
+
+  size_t findMismatch(const uint16_t *s1, const uint16_t *s2, const size_t maxcount,
+                      const bool ignoreCase)
+  {
+    return findMismatch_dispatch(s1, s2, maxcount, ignoreCase);
+  }
+
+  size_t findMismatch(const uint32_t *s1, const uint32_t *s2, const size_t maxcount,
+                      const bool ignoreCase)
+  {
+    return findMismatch_dispatch(s1, s2, maxcount, ignoreCase);
+  }
+
+  size_t findDifference(const uint8_t *s1, const uint8_t *s2, const size_t len,
+                        const bool ignoreCase)
+  {
+    return findDifference_dispatch(s1, s2, len, ignoreCase);
+  }
+
+  size_t findDifference(const uint16_t *s1, const uint16_t *s2, const size_t len,
+                        const bool ignoreCase)
+  {
+    return findDifference_dispatch(s1, s2, len, ignoreCase);
+  }
+
+  size_t findDifference(const uint32_t *s1, const uint32_t *s2, const size_t len,
+                        const bool ignoreCase)
+  {
+    return findDifference_dispatch(s1, s2, len, ignoreCase);
+  }
+
+  size_t findSubstring(const uint8_t *hay, const size_t hayLen,
+                       const uint8_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return findSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t findSubstring(const uint16_t *hay, const size_t hayLen,
+                       const uint16_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return findSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  size_t findSubstring(const uint32_t *hay, const size_t hayLen,
+                       const uint32_t *needle, const size_t needleLen, const bool ignoreCase)
+  {
+    return findSubstring_dispatch(hay, hayLen, needle, needleLen, ignoreCase);
+  }
+
+  uint64_t matchSet(const uint8_t *s, const size_t len, const uint8_t *set, const size_t setLen)
+  {
+    return matchSet_dispatch(s, len, set, setLen);
+  }
+
+  uint64_t matchSet(const uint16_t *s, const size_t len, const uint16_t *set, const size_t setLen)
+  {
+    return matchSet_dispatch(s, len, set, setLen);
+  }
+
+  uint64_t matchSet(const uint32_t *s, const size_t len, const uint32_t *set, const size_t setLen)
+  {
+    return matchSet_dispatch(s, len, set, setLen);
+  }
+
+  void replaceChar(uint8_t *s, const size_t len, const uint8_t before, const uint8_t after,
+                   const bool ignoreCase)
+  {
+    replaceChar_dispatch(s, len, before, after, ignoreCase);
+  }
+
+  void replaceChar(uint16_t *s, const size_t len, const uint16_t before, const uint16_t after,
+                   const bool ignoreCase)
+  {
+    replaceChar_dispatch(s, len, before, after, ignoreCase);
+  }
+
+  void replaceChar(uint32_t *s, const size_t len, const uint32_t before, const uint32_t after,
+                   const bool ignoreCase)
+  {
+    replaceChar_dispatch(s, len, before, after, ignoreCase);
+  }
+
+  void toLower(uint8_t *s, const size_t len)
+  {
+    Kernels<uint8_t>::get().mapLower(s, len);
+  }
+
+  void toLower(uint16_t *s, const size_t len)
+  {
+    Kernels<uint16_t>::get().mapLower(s, len);
+  }
+
+  void toLower(uint32_t *s, const size_t len)
+  {
+    Kernels<uint32_t>::get().mapLower(s, len);
+  }
+
+  void toUpper(uint8_t *s, const size_t len)
+  {
+    Kernels<uint8_t>::get().mapUpper(s, len);
+  }
+
+  void toUpper(uint16_t *s, const size_t len)
+  {
+    Kernels<uint16_t>::get().mapUpper(s, len);
+  }
+
+  void toUpper(uint32_t *s, const size_t len)
+  {
+    Kernels<uint32_t>::get().mapUpper(s, len);
+  }
+
+  size_t findZero(const uint8_t *s, const size_t maxcount)
+  {
+    return findZero_dispatch(s, maxcount);
+  }
+
+  size_t findZero(const uint16_t *s, const size_t maxcount)
+  {
+    return findZero_dispatch(s, maxcount);
+  }
+
+  size_t findZero(const uint32_t *s, const size_t maxcount)
+  {
+    return findZero_dispatch(s, maxcount);
+  }
+
+}; // namespace priv_simd
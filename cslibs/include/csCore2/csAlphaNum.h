@@ -32,22 +32,185 @@
 #ifndef __CSALPHANUM_H__
 #define __CSALPHANUM_H__
 
+#include <type_traits>
+
 #include <csCore2/cscore2_config.h>
 
+// The fixed width type formatting the integral type T; e.g. long and
+// unsigned long differ in width between platforms.
+template<typename T>
+struct csFixedInt {
+  typedef typename std::conditional<std::is_signed<T>::value,
+      typename std::conditional<sizeof(T) <= sizeof(int32_t),int32_t,int64_t>::type,
+      typename std::conditional<sizeof(T) <= sizeof(uint32_t),uint32_t,uint64_t>::type>::type type;
+};
+
+enum csNumError {
+  csNumNoError = 0,
+  csNumInvalidArgument, // no digits or invalid base
+  csNumOutOfRange,      // parsed value not representable by the target type
+  csNumValueTooLarge    // formatted value does not fit the output range
+};
+
+template<typename CharT>
+struct csFromCharsResult {
+  const CharT *ptr; // first character not matching the number's pattern
+  csNumError error;
+};
+
+template<typename CharT>
+struct csToCharsResult {
+  CharT *ptr;       // one past the last character written
+  csNumError error;
+};
+
+// Formats value into [first,last) without a terminating NUL; digits
+// greater than 9 are lower case.
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const int32_t value, const int base = 10);
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const uint32_t value, const int base = 10);
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const int64_t value, const int base = 10);
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const uint64_t value, const int base = 10);
+
+// Any other integral type, e.g. long long or DWORD
+template<typename CharT, typename T>
+inline typename std::enable_if<std::is_integral<T>::value,csToCharsResult<CharT>>::type
+csToChars(CharT *first, CharT *last, const T value, const int base = 10)
+{
+  return csToChars(first, last, typename csFixedInt<T>::type(value), base);
+}
+
+// Shortest representation that parses back to value, in fixed or
+// scientific notation, whichever is shorter.
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const float value);
+
+template<typename CharT>
+csToCharsResult<CharT> csToChars(CharT *first, CharT *last, const double value);
+
+// Parses an optional '-' (signed types only) followed by at least one
+// digit from [first,last); value is only modified on success.
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, int32_t& value, const int base = 10);
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, uint32_t& value, const int base = 10);
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, int64_t& value, const int base = 10);
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, uint64_t& value, const int base = 10);
+
+// Parses an optional '-' followed by a decimal number in fixed or
+// scientific notation, "inf", "infinity" or "nan"; rounds to nearest.
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, float& value);
+
+template<typename CharT>
+csFromCharsResult<CharT> csFromChars(const CharT *first, const CharT *last, double& value);
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const int32_t num, const int base = 10);
+
 template<typename CharT>
 CharT *csToStr(CharT *s, const size_t maxsize, const uint32_t num, const int base = 10);
 
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const int64_t num, const int base = 10);
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const uint64_t num, const int base = 10);
+
+template<typename CharT, typename T>
+inline typename std::enable_if<std::is_integral<T>::value,CharT*>::type
+csToStr(CharT *s, const size_t maxsize, const T num, const int base = 10)
+{
+  return csToStr(s, maxsize, typename csFixedInt<T>::type(num), base);
+}
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const float num);
+
+template<typename CharT>
+CharT *csToStr(CharT *s, const size_t maxsize, const double num);
+
+template<typename CharT>
+int32_t csToInt(const CharT *s, bool *ok = 0, const int base = 10);
+
 template<typename CharT>
 uint32_t csToUInt(const CharT *s, bool *ok = 0, const int base = 10);
 
+template<typename CharT>
+int64_t csToInt64(const CharT *s, bool *ok = 0, const int base = 10);
+
+template<typename CharT>
+uint64_t csToUInt64(const CharT *s, bool *ok = 0, const int base = 10);
+
+template<typename CharT>
+float csToFloat(const CharT *s, bool *ok = 0);
+
+template<typename CharT>
+double csToDouble(const CharT *s, bool *ok = 0);
+
 #ifdef HAVE_CHAR
+extern template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const int32_t value, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const uint32_t value, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const int64_t value, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const uint64_t value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, int32_t& value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, uint32_t& value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, int64_t& value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, uint64_t& value, const int base);
+extern template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const int32_t num, const int base);
 extern template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const uint32_t num, const int base);
+extern template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const int64_t num, const int base);
+extern template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const uint64_t num, const int base);
+extern template CS_CORE2_EXPORT int32_t csToInt<char>(const char *s, bool *ok, const int base);
 extern template CS_CORE2_EXPORT uint32_t csToUInt<char>(const char *s, bool *ok, const int base);
+extern template CS_CORE2_EXPORT int64_t csToInt64<char>(const char *s, bool *ok, const int base);
+extern template CS_CORE2_EXPORT uint64_t csToUInt64<char>(const char *s, bool *ok, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const float value);
+extern template CS_CORE2_EXPORT csToCharsResult<char> csToChars<char>(char *first, char *last, const double value);
+extern template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, float& value);
+extern template CS_CORE2_EXPORT csFromCharsResult<char> csFromChars<char>(const char *first, const char *last, double& value);
+extern template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const float num);
+extern template CS_CORE2_EXPORT char *csToStr<char>(char *s, const size_t maxsize, const double num);
+extern template CS_CORE2_EXPORT float csToFloat<char>(const char *s, bool *ok);
+extern template CS_CORE2_EXPORT double csToDouble<char>(const char *s, bool *ok);
 #endif
 
 #ifdef HAVE_WCHAR_T
+extern template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const int32_t value, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const uint32_t value, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const int64_t value, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const uint64_t value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, int32_t& value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, uint32_t& value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, int64_t& value, const int base);
+extern template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, uint64_t& value, const int base);
+extern template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const int32_t num, const int base);
 extern template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const uint32_t num, const int base);
+extern template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const int64_t num, const int base);
+extern template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const uint64_t num, const int base);
+extern template CS_CORE2_EXPORT int32_t csToInt<wchar_t>(const wchar_t *s, bool *ok, const int base);
 extern template CS_CORE2_EXPORT uint32_t csToUInt<wchar_t>(const wchar_t *s, bool *ok, const int base);
+extern template CS_CORE2_EXPORT int64_t csToInt64<wchar_t>(const wchar_t *s, bool *ok, const int base);
+extern template CS_CORE2_EXPORT uint64_t csToUInt64<wchar_t>(const wchar_t *s, bool *ok, const int base);
+extern template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const float value);
+extern template CS_CORE2_EXPORT csToCharsResult<wchar_t> csToChars<wchar_t>(wchar_t *first, wchar_t *last, const double value);
+extern template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, float& value);
+extern template CS_CORE2_EXPORT csFromCharsResult<wchar_t> csFromChars<wchar_t>(const wchar_t *first, const wchar_t *last, double& value);
+extern template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const float num);
+extern template CS_CORE2_EXPORT wchar_t *csToStr<wchar_t>(wchar_t *s, const size_t maxsize, const double num);
+extern template CS_CORE2_EXPORT float csToFloat<wchar_t>(const wchar_t *s, bool *ok);
+extern template CS_CORE2_EXPORT double csToDouble<wchar_t>(const wchar_t *s, bool *ok);
 #endif
 
 #endif // __CSALPHANUM_H__
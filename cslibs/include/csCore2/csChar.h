@@ -35,19 +35,62 @@
 #include <csCore2/cscore2_config.h>
 
 template<typename CharT>
-CharT csToLower(const CharT ch);
+constexpr CharT csToLower(const CharT ch)
+{
+  return CharT('A') <= ch  &&  ch <= CharT('Z')
+      ? CharT(ch - CharT('A') + CharT('a'))
+      : ch;
+}
 
 template<typename CharT>
-CharT csToUpper(const CharT ch);
+constexpr CharT csToUpper(const CharT ch)
+{
+  return CharT('a') <= ch  &&  ch <= CharT('z')
+      ? CharT(ch - CharT('a') + CharT('A'))
+      : ch;
+}
+
+// Maps s[0,len) in place, like csToLower() (csToUpper()).
+template<typename CharT>
+void csToLower(CharT *s, const size_t len);
+
+template<typename CharT>
+void csToUpper(CharT *s, const size_t len);
+
+namespace priv_char {
+
+  CS_CORE2_EXPORT wchar_t toLowerUnicode(const wchar_t ch);
+  CS_CORE2_EXPORT wchar_t toUpperUnicode(const wchar_t ch);
+
+}; // namespace priv_char
+
+// Simple (1:1) Unicode case mapping; ASCII is mapped inline, everything
+// else by table lookup. Surrogates (UTF-16) are returned as is.
+inline wchar_t csToLowerUnicode(const wchar_t ch)
+{
+  return ch < wchar_t(0x80)
+      ? csToLower(ch)
+      : priv_char::toLowerUnicode(ch);
+}
+
+inline wchar_t csToUpperUnicode(const wchar_t ch)
+{
+  return ch < wchar_t(0x80)
+      ? csToUpper(ch)
+      : priv_char::toUpperUnicode(ch);
+}
+
+CS_CORE2_EXPORT void csToLowerUnicode(wchar_t *s, const size_t len);
+CS_CORE2_EXPORT void csToUpperUnicode(wchar_t *s, const size_t len);
 
 #ifdef HAVE_CHAR
-extern template CS_CORE2_EXPORT char csToLower<char>(const char ch);
-extern template CS_CORE2_EXPORT char csToUpper<char>(const char ch);
+extern template CS_CORE2_EXPORT void csToLower<char>(char *s, const size_t len);
+extern template CS_CORE2_EXPORT void csToUpper<char>(char *s, const size_t len);
 #endif
 
 #ifdef HAVE_WCHAR_T
-extern template CS_CORE2_EXPORT wchar_t csToLower<wchar_t>(const wchar_t ch);
-extern template CS_CORE2_EXPORT wchar_t csToUpper<wchar_t>(const wchar_t ch);
+extern template CS_CORE2_EXPORT void csToLower<wchar_t>(wchar_t *s, const size_t len);
+extern template CS_CORE2_EXPORT void csToUpper<wchar_t>(wchar_t *s, const size_t len);
 #endif
 
 #endif // __CSCHAR_H__
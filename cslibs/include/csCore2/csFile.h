@@ -34,13 +34,78 @@
 
 #include <csCore2/cscore2_config.h>
 
+#include <functional>
+#include <vector>
+
 #include <csCore2/csStringList.h>
+#include <csCore2/csStringTable.h>
+#include <csCore2/csStringView.h>
+
+enum csFileType {
+  csFileTypeUnknown = 0,
+  csFileTypeFile,
+  csFileTypeDirectory,
+  csFileTypeSymLink,  // the link itself; also junctions on Windows
+  csFileTypeOther     // devices, pipes, sockets
+};
 
 CS_CORE2_EXPORT bool csFileExists(const wchar_t *name);
 
 CS_CORE2_EXPORT bool csIsDirectory(const wchar_t *name);
 CS_CORE2_EXPORT bool csIsFile(const wchar_t *name);
 
+// On Windows, path is a FindFirstFile() pattern, e.g. "C:\dir\*.txt".
+// Elsewhere, path is a directory, or a directory followed by a csGlob
+// pattern containing '*' or '?', e.g. "/dir/*.txt"; names are matched
+// case-sensitively. Both include "." and "..", if they match. Nothing is
+// listed if the directory cannot be read completely.
+// NOTE: Outside Windows, each byte of a name that is not valid UTF-8 is
+//       listed as U+DC80-U+DCFF; paths holding these refer to the original
+//       name.
+
 CS_CORE2_EXPORT csWStringList csListDirectory(const wchar_t *path);
+// Appends the names to files; returns the number of names appended.
+CS_CORE2_EXPORT size_t csListDirectory(csWStringTable *files, const wchar_t *path);
+// As above; also appends each entry's type to types, if not null. The type
+// is reported by the directory listing itself, without querying each entry.
+CS_CORE2_EXPORT size_t csListDirectory(csWStringTable *files, std::vector<csFileType> *types,
+                                       const wchar_t *path);
+
+enum csWalkSymLinks {
+  csWalkSymLinksReport = 0, // report as csFileTypeSymLink, never descend
+  csWalkSymLinksFollow,     // report the target's type, descend once per directory
+  csWalkSymLinksSkip
+};
+
+struct csWalkOptions {
+  // csGlob patterns; a pattern without separator matches the entry's name,
+  // any other its relative path. Entries must match an include pattern,
+  // if any, to be reported; excluded directories are not descended.
+  csWStringList include;
+  csWStringList exclude;
+  bool ignoreCase = false;
+  int maxDepth = -1; // deepest level reported; 0 is root's entries, < 0 is unlimited
+  csWalkSymLinks symLinks = csWalkSymLinksReport;
+  int threadCount = 0; // < 1 selects the number of hardware threads
+};
+
+struct csWalkEntry {
+  csWStringView path;         // root and the relative path
+  csWStringView relativePath;
+  csWStringView name;
+  csFileType type;
+  int depth;
+};
+
+// Returning false stops the walk.
+typedef std::function<bool(const csWalkEntry& entry)> csWalkFunc;
+
+// Walks the tree below root, listing subdirectories concurrently; func is
+// called while walking, from all threads at once. "." and ".." are never
+// reported. Returns false if a pattern is invalid, func stopped the walk,
+// or root or any subdirectory cannot be listed completely; the walk goes
+// on past subdirectories that fail.
+CS_CORE2_EXPORT bool csWalkDirectory(const wchar_t *root, const csWalkFunc& func,
+                                     const csWalkOptions& options = csWalkOptions());
 
 #endif // __CSFILE_H__
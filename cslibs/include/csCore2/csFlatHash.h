@@ -0,0 +1,881 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSFLATHASH_H__
+#define __CSFLATHASH_H__
+
+#include <cstring>
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csHash.h>
+#include <csCore2/csString.h>
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define CS_FLATHASH_SSE2
+# include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+# include <intrin.h>
+#endif
+
+////// Private ///////////////////////////////////////////////////////////////
+
+namespace priv_flathash {
+
+  // NOTE: The slots are partitioned into groups, each with one control
+  //       byte per slot; all control bytes of a group are probed at once.
+  //       A full slot's control byte holds 7 bits of its key's hash.
+
+  const size_t GROUP_SIZE = 16;
+
+  const int8_t EMPTY   = -128;
+  const int8_t DELETED = -2;
+
+  inline int ctz32(const uint32_t x)
+  {
+#ifdef _MSC_VER
+    unsigned long idx;
+    _BitScanForward(&idx, x);
+    return int(idx);
+#else
+    return __builtin_ctz(x);
+#endif
+  }
+
+  // Bit i of a mask corresponds to slot i of the group
+  class Group {
+  public:
+    explicit Group(const int8_t *ctrl)
+#ifdef CS_FLATHASH_SSE2
+      : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+#else
+      : _ctrl(ctrl)
+#endif
+    {
+    }
+
+#ifdef CS_FLATHASH_SSE2
+    uint32_t match(const int8_t h2) const
+    {
+      return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_ctrl, _mm_set1_epi8(h2))));
+    }
+
+    uint32_t matchEmpty() const
+    {
+      return match(EMPTY);
+    }
+
+    uint32_t matchEmptyOrDeleted() const
+    {
+      return uint32_t(_mm_movemask_epi8(_ctrl));
+    }
+#else
+    uint32_t match(const int8_t h2) const
+    {
+      uint32_t mask = 0;
+      for(size_t i = 0; i < GROUP_SIZE; i++) {
+        if( _ctrl[i] == h2 ) {
+          mask |= uint32_t(1) << i;
+        }
+      }
+      return mask;
+    }
+
+    uint32_t matchEmpty() const
+    {
+      return match(EMPTY);
+    }
+
+    uint32_t matchEmptyOrDeleted() const
+    {
+      uint32_t mask = 0;
+      for(size_t i = 0; i < GROUP_SIZE; i++) {
+        if( _ctrl[i] < 0 ) {
+          mask |= uint32_t(1) << i;
+        }
+      }
+      return mask;
+    }
+#endif
+
+  private:
+#ifdef CS_FLATHASH_SSE2
+    __m128i _ctrl;
+#else
+    const int8_t *_ctrl;
+#endif
+  };
+
+  // Spreads the bits of weak hashes (e.g. std::hash<int>, the identity)
+  inline uint64_t mix(const size_t h)
+  {
+    const uint64_t x = uint64_t(h)*0x9E3779B97F4A7C15;
+    return x ^ (x >> 32);
+  }
+
+  inline int8_t h2(const uint64_t h)
+  {
+    return int8_t(h >> 57);
+  }
+
+  template<typename SlotT, bool IS_CONST>
+  class Iterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef SlotT                     value_type;
+    typedef ptrdiff_t                 difference_type;
+    typedef typename std::conditional<IS_CONST,const SlotT*,SlotT*>::type pointer;
+    typedef typename std::conditional<IS_CONST,const SlotT&,SlotT&>::type reference;
+
+    Iterator()
+      : _ctrl(0)
+      , _end(0)
+      , _slot(0)
+    {
+    }
+
+    Iterator(const int8_t *ctrl, const int8_t *end, pointer slot)
+      : _ctrl(ctrl)
+      , _end(end)
+      , _slot(slot)
+    {
+      skipFree();
+    }
+
+    // Iterator -> const_iterator
+    template<bool OTHER_CONST>
+    Iterator(const Iterator<SlotT,OTHER_CONST>& other)
+      : _ctrl(other._ctrl)
+      , _end(other._end)
+      , _slot(other._slot)
+    {
+    }
+
+    reference operator*() const
+    {
+      return *_slot;
+    }
+
+    pointer operator->() const
+    {
+      return _slot;
+    }
+
+    Iterator& operator++()
+    {
+      _ctrl++;
+      _slot++;
+      skipFree();
+      return *this;
+    }
+
+    Iterator operator++(int)
+    {
+      const Iterator result(*this);
+      operator++();
+      return result;
+    }
+
+    bool operator==(const Iterator& other) const
+    {
+      return _ctrl == other._ctrl;
+    }
+
+    bool operator!=(const Iterator& other) const
+    {
+      return _ctrl != other._ctrl;
+    }
+
+  private:
+    template<typename, bool>
+    friend class Iterator;
+    template<typename, typename, typename, typename>
+    friend class Table;
+
+    void skipFree()
+    {
+      while( _ctrl != _end  &&  *_ctrl < 0 ) {
+        _ctrl++;
+        _slot++;
+      }
+    }
+
+    const int8_t *_ctrl;
+    const int8_t *_end;
+    pointer _slot;
+  };
+
+  // Open addressing hash table; the policy extracts the key from a slot.
+  template<typename SlotT, typename PolicyT, typename HashT, typename EqualT>
+  class Table {
+  public:
+    typedef Iterator<SlotT,false> iterator;
+    typedef Iterator<SlotT,true>  const_iterator;
+
+    static const size_t NOT_FOUND = ~size_t(0);
+
+    Table()
+      : _ctrl(0)
+      , _slots(0)
+      , _capacity(0)
+      , _size(0)
+      , _growthLeft(0)
+      , _hash()
+      , _equal()
+    {
+    }
+
+    Table(const Table& other)
+      : Table()
+    {
+      copyFrom(other);
+    }
+
+    Table(Table&& other) noexcept
+      : Table()
+    {
+      swap(other);
+    }
+
+    ~Table()
+    {
+      destroy();
+    }
+
+    Table& operator=(const Table& other)
+    {
+      if( this != &other ) {
+        destroy();
+        copyFrom(other);
+      }
+      return *this;
+    }
+
+    Table& operator=(Table&& other) noexcept
+    {
+      if( this != &other ) {
+        destroy();
+        swap(other);
+      }
+      return *this;
+    }
+
+    iterator begin()
+    {
+      return iterator(_ctrl, _ctrl + _capacity, _slots);
+    }
+
+    const_iterator begin() const
+    {
+      return const_iterator(_ctrl, _ctrl + _capacity, _slots);
+    }
+
+    iterator end()
+    {
+      return iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity);
+    }
+
+    const_iterator end() const
+    {
+      return const_iterator(_ctrl + _capacity, _ctrl + _capacity, _slots + _capacity);
+    }
+
+    iterator iteratorAt(const size_t i)
+    {
+      return i != NOT_FOUND
+          ? iterator(_ctrl + i, _ctrl + _capacity, _slots + i)
+          : end();
+    }
+
+    const_iterator iteratorAt(const size_t i) const
+    {
+      return i != NOT_FOUND
+          ? const_iterator(_ctrl + i, _ctrl + _capacity, _slots + i)
+          : end();
+    }
+
+    size_t capacity() const
+    {
+      return _capacity;
+    }
+
+    size_t size() const
+    {
+      return _size;
+    }
+
+    void clear()
+    {
+      if( _capacity < 1 ) {
+        return;
+      }
+      for(size_t i = 0; i < _capacity; i++) {
+        if( _ctrl[i] >= 0 ) {
+          _slots[i].~SlotT();
+        }
+      }
+      memset(_ctrl, EMPTY, _capacity);
+      _size       = 0;
+      _growthLeft = maxLoad(_capacity);
+    }
+
+    template<typename K>
+    size_t find(const K& key) const
+    {
+      return find(key, hashOf(key));
+    }
+
+    // Returns the slot of key and whether it was constructed from args.
+    template<typename K, typename... ArgsT>
+    std::pair<size_t,bool> emplace(const K& key, ArgsT&&... args)
+    {
+      const uint64_t h = hashOf(key);
+
+      size_t i = find(key, h);
+      if( i != NOT_FOUND ) {
+        return std::pair<size_t,bool>(i, false);
+      }
+
+      if( _growthLeft < 1 ) {
+        grow();
+      }
+      i = findFree(h);
+      ::new(static_cast<void*>(_slots + i)) SlotT(std::forward<ArgsT>(args)...);
+      if( _ctrl[i] == EMPTY ) {
+        _growthLeft--;
+      }
+      _ctrl[i] = h2(h);
+      _size++;
+
+      return std::pair<size_t,bool>(i, true);
+    }
+
+    void eraseAt(const size_t i)
+    {
+      _slots[i].~SlotT();
+      _size--;
+
+      // NOTE: A probe continues past a group only if it has no empty
+      //       slot; such a group must not become "empty" again.
+      const size_t first = i & ~(GROUP_SIZE - 1);
+      if( Group(_ctrl + first).matchEmpty() != 0 ) {
+        _ctrl[i] = EMPTY;
+        _growthLeft++;
+      } else {
+        _ctrl[i] = DELETED;
+      }
+    }
+
+    template<typename K>
+    size_t erase(const K& key)
+    {
+      const size_t i = find(key);
+      if( i == NOT_FOUND ) {
+        return 0;
+      }
+      eraseAt(i);
+      return 1;
+    }
+
+    size_t indexOf(const const_iterator& it) const
+    {
+      return size_t(it._ctrl - _ctrl);
+    }
+
+    void reserve(const size_t count)
+    {
+      if( count > maxLoad(_capacity) ) {
+        rehash(capacityFor(count));
+      }
+    }
+
+    SlotT& slot(const size_t i)
+    {
+      return _slots[i];
+    }
+
+    const SlotT& slot(const size_t i) const
+    {
+      return _slots[i];
+    }
+
+    void swap(Table& other) noexcept
+    {
+      std::swap(_ctrl, other._ctrl);
+      std::swap(_slots, other._slots);
+      std::swap(_capacity, other._capacity);
+      std::swap(_size, other._size);
+      std::swap(_growthLeft, other._growthLeft);
+      std::swap(_hash, other._hash);
+      std::swap(_equal, other._equal);
+    }
+
+  private:
+    // Up to 7/8 of the slots are used
+    static size_t maxLoad(const size_t capacity)
+    {
+      return capacity - capacity/8;
+    }
+
+    static size_t capacityFor(const size_t count)
+    {
+      size_t capacity = GROUP_SIZE;
+      while( maxLoad(capacity) < count ) {
+        capacity *= 2;
+      }
+      return capacity;
+    }
+
+    template<typename K>
+    uint64_t hashOf(const K& key) const
+    {
+      return mix(size_t(_hash(key)));
+    }
+
+    template<typename K>
+    size_t find(const K& key, const uint64_t h) const
+    {
+      if( _capacity < 1 ) {
+        return NOT_FOUND;
+      }
+
+      const size_t mask = _capacity/GROUP_SIZE - 1;
+      size_t group = size_t(h) & mask;
+      for(size_t step = 1; ; step++) {
+        const int8_t *ctrl = _ctrl + group*GROUP_SIZE;
+        const Group g(ctrl);
+
+        for(uint32_t m = g.match(h2(h)); m != 0; m &= m - 1) {
+          const size_t i = group*GROUP_SIZE + size_t(ctz32(m));
+          if( _equal(PolicyT::key(_slots[i]), key) ) {
+            return i;
+          }
+        }
+
+        if( g.matchEmpty() != 0 ) {
+          return NOT_FOUND;
+        }
+
+        // Triangular numbers visit every group once
+        group = (group + step) & mask;
+      }
+    }
+
+    size_t findFree(const uint64_t h) const
+    {
+      const size_t mask = _capacity/GROUP_SIZE - 1;
+      size_t group = size_t(h) & mask;
+      for(size_t step = 1; ; step++) {
+        const uint32_t m = Group(_ctrl + group*GROUP_SIZE).matchEmptyOrDeleted();
+        if( m != 0 ) {
+          return group*GROUP_SIZE + size_t(ctz32(m));
+        }
+        group = (group + step) & mask;
+      }
+    }
+
+    void grow()
+    {
+      // Many deleted slots; reclaim them without growing
+      const size_t capacity = _size < maxLoad(_capacity)/2
+          ? _capacity
+          : capacityFor(_size + 1);
+      rehash(capacity < GROUP_SIZE
+             ? GROUP_SIZE
+             : capacity);
+    }
+
+    void allocate(const size_t capacity)
+    {
+      _ctrl       = new int8_t[capacity];
+      _slots      = std::allocator<SlotT>().allocate(capacity);
+      _capacity   = capacity;
+      _size       = 0;
+      _growthLeft = maxLoad(capacity);
+      memset(_ctrl, EMPTY, capacity);
+    }
+
+    void deallocate()
+    {
+      if( _capacity > 0 ) {
+        delete[] _ctrl;
+        std::allocator<SlotT>().deallocate(_slots, _capacity);
+      }
+      _ctrl       = 0;
+      _slots      = 0;
+      _capacity   = 0;
+      _size       = 0;
+      _growthLeft = 0;
+    }
+
+    void destroy()
+    {
+      clear();
+      deallocate();
+    }
+
+    void copyFrom(const Table& other)
+    {
+      _hash  = other._hash;
+      _equal = other._equal;
+      if( other._capacity < 1 ) {
+        return;
+      }
+
+      // NOTE: Deleted slots are kept to preserve the probe sequences.
+      allocate(other._capacity);
+      for(size_t i = 0; i < other._capacity; i++) {
+        if( other._ctrl[i] >= 0 ) {
+          ::new(static_cast<void*>(_slots + i)) SlotT(other._slots[i]);
+          _ctrl[i] = other._ctrl[i];
+          _size++;
+        }
+      }
+      memcpy(_ctrl, other._ctrl, _capacity);
+      _growthLeft = other._growthLeft;
+    }
+
+    void rehash(const size_t capacity)
+    {
+      int8_t  *oldCtrl     = _ctrl;
+      SlotT   *oldSlots    = _slots;
+      const size_t oldCapacity = _capacity;
+
+      allocate(capacity);
+      for(size_t i = 0; i < oldCapacity; i++) {
+        if( oldCtrl[i] >= 0 ) {
+          const uint64_t h = hashOf(PolicyT::key(oldSlots[i]));
+          const size_t j   = findFree(h);
+          ::new(static_cast<void*>(_slots + j)) SlotT(std::move(oldSlots[i]));
+          oldSlots[i].~SlotT();
+          _ctrl[j] = h2(h);
+          _size++;
+          _growthLeft--;
+        }
+      }
+
+      if( oldCapacity > 0 ) {
+        delete[] oldCtrl;
+        std::allocator<SlotT>().deallocate(oldSlots, oldCapacity);
+      }
+    }
+
+    int8_t *_ctrl;
+    SlotT  *_slots;
+    size_t _capacity;
+    size_t _size;
+    size_t _growthLeft; // slots to fill before the table grows
+    HashT  _hash;
+    EqualT _equal;
+  };
+
+  template<typename KeyT, typename ValueT>
+  struct MapPolicy {
+    static const KeyT& key(const std::pair<KeyT,ValueT>& slot)
+    {
+      return slot.first;
+    }
+  };
+
+  template<typename KeyT>
+  struct SetPolicy {
+    static const KeyT& key(const KeyT& slot)
+    {
+      return slot;
+    }
+  };
+
+}; // namespace priv_flathash
+
+////// Public ////////////////////////////////////////////////////////////////
+
+// Default hash & equality; strings hash with csHash() and are looked up
+// by views or pointers without creating a temporary key.
+template<typename KeyT>
+struct csFlatHashTraits {
+  typedef std::hash<KeyT>     hasher;
+  typedef std::equal_to<KeyT> key_equal;
+};
+
+template<typename CharT>
+struct csFlatHashTraits<csBasicString<CharT>> {
+  typedef csStringHash<CharT> hasher;
+  typedef std::equal_to<>     key_equal;
+};
+
+// Hash map storing its entries in one array (open addressing; SIMD probing
+// of 16 slots at once). Inserting and erasing invalidate iterators and
+// references. Keys of the entries must not be modified.
+template<typename KeyT, typename ValueT,
+         typename HashT  = typename csFlatHashTraits<KeyT>::hasher,
+         typename EqualT = typename csFlatHashTraits<KeyT>::key_equal>
+class csFlatHashMap {
+  typedef priv_flathash::Table<std::pair<KeyT,ValueT>,
+                               priv_flathash::MapPolicy<KeyT,ValueT>,
+                               HashT,EqualT> Table;
+
+public:
+  typedef KeyT                    key_type;
+  typedef ValueT                  mapped_type;
+  typedef std::pair<KeyT,ValueT>  value_type;
+  typedef typename Table::iterator       iterator;
+  typedef typename Table::const_iterator const_iterator;
+
+  iterator begin()
+  {
+    return _table.begin();
+  }
+
+  const_iterator begin() const
+  {
+    return _table.begin();
+  }
+
+  iterator end()
+  {
+    return _table.end();
+  }
+
+  const_iterator end() const
+  {
+    return _table.end();
+  }
+
+  size_t capacity() const
+  {
+    return _table.capacity();
+  }
+
+  bool empty() const
+  {
+    return _table.size() < 1;
+  }
+
+  size_t size() const
+  {
+    return _table.size();
+  }
+
+  void clear()
+  {
+    _table.clear();
+  }
+
+  void reserve(const size_t count)
+  {
+    _table.reserve(count);
+  }
+
+  template<typename K>
+  bool contains(const K& key) const
+  {
+    return _table.find(key) != Table::NOT_FOUND;
+  }
+
+  template<typename K>
+  size_t count(const K& key) const
+  {
+    return contains(key) ? 1 : 0;
+  }
+
+  template<typename K>
+  iterator find(const K& key)
+  {
+    return _table.iteratorAt(_table.find(key));
+  }
+
+  template<typename K>
+  const_iterator find(const K& key) const
+  {
+    return _table.iteratorAt(_table.find(key));
+  }
+
+  // KeyT & ValueT are constructed only if key is not found.
+  template<typename K, typename... ArgsT>
+  std::pair<iterator,bool> try_emplace(K&& key, ArgsT&&... args)
+  {
+    const std::pair<size_t,bool> result =
+        _table.emplace(key, std::piecewise_construct,
+                       std::forward_as_tuple(std::forward<K>(key)),
+                       std::forward_as_tuple(std::forward<ArgsT>(args)...));
+    return std::pair<iterator,bool>(_table.iteratorAt(result.first), result.second);
+  }
+
+  std::pair<iterator,bool> insert(const value_type& value)
+  {
+    return try_emplace(value.first, value.second);
+  }
+
+  std::pair<iterator,bool> insert(value_type&& value)
+  {
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+
+  template<typename K>
+  ValueT& operator[](K&& key)
+  {
+    return try_emplace(std::forward<K>(key)).first->second;
+  }
+
+  template<typename K>
+  size_t erase(const K& key)
+  {
+    return _table.erase(key);
+  }
+
+  iterator erase(iterator pos)
+  {
+    return erase(const_iterator(pos));
+  }
+
+  iterator erase(const_iterator pos)
+  {
+    const size_t i = _table.indexOf(pos);
+    _table.eraseAt(i);
+    return _table.iteratorAt(i);
+  }
+
+  void swap(csFlatHashMap& other) noexcept
+  {
+    _table.swap(other._table);
+  }
+
+private:
+  Table _table;
+};
+
+// Hash set storing its keys in one array; see csFlatHashMap.
+template<typename KeyT,
+         typename HashT  = typename csFlatHashTraits<KeyT>::hasher,
+         typename EqualT = typename csFlatHashTraits<KeyT>::key_equal>
+class csFlatHashSet {
+  typedef priv_flathash::Table<KeyT,
+                               priv_flathash::SetPolicy<KeyT>,
+                               HashT,EqualT> Table;
+
+public:
+  typedef KeyT key_type;
+  typedef KeyT value_type;
+  // Keys must not be modified
+  typedef typename Table::const_iterator iterator;
+  typedef typename Table::const_iterator const_iterator;
+
+  const_iterator begin() const
+  {
+    return _table.begin();
+  }
+
+  const_iterator end() const
+  {
+    return _table.end();
+  }
+
+  size_t capacity() const
+  {
+    return _table.capacity();
+  }
+
+  bool empty() const
+  {
+    return _table.size() < 1;
+  }
+
+  size_t size() const
+  {
+    return _table.size();
+  }
+
+  void clear()
+  {
+    _table.clear();
+  }
+
+  void reserve(const size_t count)
+  {
+    _table.reserve(count);
+  }
+
+  template<typename K>
+  bool contains(const K& key) const
+  {
+    return _table.find(key) != Table::NOT_FOUND;
+  }
+
+  template<typename K>
+  size_t count(const K& key) const
+  {
+    return contains(key) ? 1 : 0;
+  }
+
+  template<typename K>
+  const_iterator find(const K& key) const
+  {
+    return _table.iteratorAt(_table.find(key));
+  }
+
+  // KeyT is constructed only if key is not found.
+  template<typename K>
+  std::pair<const_iterator,bool> insert(K&& key)
+  {
+    const std::pair<size_t,bool> result = _table.emplace(key, std::forward<K>(key));
+    return std::pair<const_iterator,bool>(_table.iteratorAt(result.first), result.second);
+  }
+
+  template<typename K>
+  size_t erase(const K& key)
+  {
+    return _table.erase(key);
+  }
+
+  const_iterator erase(const_iterator pos)
+  {
+    const size_t i = _table.indexOf(pos);
+    _table.eraseAt(i);
+    return _table.iteratorAt(i);
+  }
+
+  void swap(csFlatHashSet& other) noexcept
+  {
+    _table.swap(other._table);
+  }
+
+private:
+  Table _table;
+};
+
+#endif // __CSFLATHASH_H__
@@ -0,0 +1,137 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSFUZZYMATCHER_H__
+#define __CSFUZZYMATCHER_H__
+
+#include <string>
+#include <vector>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringTable.h>
+
+struct csFuzzyMatch {
+  size_t index; // of the candidate
+  int score;    // higher is better
+};
+
+// Strings to be searched by csFuzzyMatcher::findBest(); each string's
+// characters are summarized in a 64-bit mask when appended, so that most
+// candidates not containing all of a pattern's characters are rejected
+// without reading them.
+template<typename CharT>
+class csFuzzyCandidates {
+public:
+  csFuzzyCandidates();
+  ~csFuzzyCandidates();
+
+  void append(const csBasicStringView<CharT>& s);
+  void clear();
+  // Capacity for count strings of length characters in total
+  void reserve(const size_t count, const size_t length);
+
+  size_t size() const
+  {
+    return _masks.size();
+  }
+
+  bool empty() const
+  {
+    return _masks.empty();
+  }
+
+  csBasicStringView<CharT> operator[](const size_t i) const
+  {
+    return _strings[i];
+  }
+
+  const uint64_t *masks() const
+  {
+    return _masks.data();
+  }
+
+private:
+  csBasicStringTable<CharT> _strings;
+  std::vector<uint64_t> _masks;
+};
+
+// Matches the pattern's characters in order, but not necessarily adjacent,
+// against a text, like "fzf" does: "cfm" matches "csFuzzyMatcher.h". The
+// score rewards matches at word boundaries and runs of adjacent matches,
+// and penalizes gaps; it is the best over all alignments of the pattern.
+// NOTE: If the pattern's length times the span of text it may match exceeds
+//       64K, only the tightest alignment ending at the leftmost possible
+//       position (found greedily) is scored.
+template<typename CharT>
+class csFuzzyMatcher {
+public:
+  csFuzzyMatcher();
+  explicit csFuzzyMatcher(const csBasicStringView<CharT>& pattern, const bool ignoreCase = true);
+  ~csFuzzyMatcher();
+
+  void setPattern(const csBasicStringView<CharT>& pattern, const bool ignoreCase = true);
+
+  bool ignoreCase() const;
+  const std::basic_string<CharT>& pattern() const;
+
+  // Does text contain the pattern as a subsequence?
+  bool isMatch(const csBasicStringView<CharT>& text) const;
+  // Returns < 0 if text does not match, else a score >= 0; positions
+  // receives the indices of the matched characters in text, e.g. for
+  // highlighting. The empty pattern matches any text with a score of 0.
+  int score(const csBasicStringView<CharT>& text, std::vector<size_t> *positions = 0) const;
+
+  // Returns up to maxCount matching candidates, best first; equal scores
+  // are ordered by index. Large sets are searched using threadCount
+  // threads; < 1 selects the number of hardware threads.
+  std::vector<csFuzzyMatch> findBest(const csFuzzyCandidates<CharT>& candidates,
+                                     const size_t maxCount,
+                                     const int threadCount = 1) const;
+
+private:
+  std::basic_string<CharT> _pattern; // mapped by csToLower() if ignoring case
+  std::basic_string<CharT> _original;
+  bool _ignoreCase;
+  uint64_t _mask;
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csFuzzyCandidates<char>;
+extern template class CS_CORE2_EXPORT csFuzzyMatcher<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csFuzzyCandidates<wchar_t>;
+extern template class CS_CORE2_EXPORT csFuzzyMatcher<wchar_t>;
+#endif
+
+#endif // __CSFUZZYMATCHER_H__
@@ -0,0 +1,128 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSGLOB_H__
+#define __CSGLOB_H__
+
+#include <string>
+#include <vector>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringView.h>
+
+// Wildcard pattern, compiled once and matched without allocating:
+//   *       any characters except the separators '/' and '\'
+//   **      any characters
+//   ?       any character except a separator
+//   [a-z_]  any character of the set; '!' or '^' first negates the set, ']'
+//           first is a member. Sets never match a separator.
+// Any other character, including an unterminated '[', matches itself.
+// The literal prefix and suffix of the pattern are compared first, so most
+// texts are rejected without running the matcher. Patterns of more than 1023
+// wildcards and characters between prefix and suffix allocate per match().
+template<typename CharT>
+class csGlob {
+public:
+  csGlob();
+  ~csGlob();
+
+  void clear();
+  bool compile(const csBasicStringView<CharT>& pattern, const bool ignoreCase = false);
+
+  bool ignoreCase() const;
+  bool isCompiled() const;
+  const std::basic_string<CharT>& pattern() const;
+
+  bool match(const csBasicStringView<CharT>& text) const;
+
+private:
+  enum Middle {
+    MiddleEmpty = 0,
+    MiddleSegments,   // literals separated by stars, e.g. "*abc*def*"
+    MiddleAutomaton,  // state fits one word
+    MiddleWideAutomaton
+  };
+
+  struct Segment {
+    size_t begin; // in _literals
+    size_t size;
+  };
+
+  struct Token {
+    enum Type {
+      Literal = 0,
+      Any,
+      Set,
+      Star,
+      GlobStar
+    };
+
+    Type   type;
+    CharT  ch;         // Literal
+    size_t rangeBegin; // Set
+    size_t rangeEnd;
+    bool   negate;
+  };
+
+  bool isSetMember(const Token& token, const CharT ch) const;
+  bool matchAutomaton(const CharT *text, const size_t len) const;
+  bool matchSegments(const CharT *text, const size_t len) const;
+  bool matchWideAutomaton(const CharT *text, const size_t len) const;
+  void transitionMask(const CharT ch, uint64_t *mask) const;
+
+  std::basic_string<CharT> _pattern;
+  bool _ignoreCase;
+  bool _isCompiled;
+
+  std::basic_string<CharT> _prefix;    // mapped by csToLower() if ignoring case
+  std::basic_string<CharT> _suffix;
+  size_t _minMiddle; // characters required by the middle part
+
+  Middle _middle;
+  std::basic_string<CharT> _literals;  // mapped by csToLower() if ignoring case
+  std::vector<Segment> _segments;
+  bool _crossesSeparators;
+  std::vector<Token> _tokens;          // of the middle part
+  std::vector<CharT> _ranges;          // pairs of first & last character
+  size_t _numWords;                    // of the automaton's state
+  std::vector<uint64_t> _masks;        // rows of _numWords words; see priv_glob
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csGlob<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csGlob<wchar_t>;
+#endif
+
+#endif // __CSGLOB_H__
@@ -0,0 +1,199 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSHASH_H__
+#define __CSHASH_H__
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csChar.h>
+#include <csCore2/csStringView.h>
+
+namespace priv_hash {
+
+  // Case-insensitive hashing folds the characters in blocks of this size
+  const size_t FOLD_SIZE = 256;
+
+}; // namespace priv_hash
+
+// 64-bit hash (XXH64) of numBytes at data
+CS_CORE2_EXPORT uint64_t csHashBytes(const void *data, const size_t numBytes,
+                                     const uint64_t seed = 0);
+
+// Incremental hashing; feeding the data in pieces yields the same hash as
+// hashing it all at once.
+class CS_CORE2_EXPORT csHasher {
+public:
+  explicit csHasher(const uint64_t seed = 0);
+  ~csHasher();
+
+  void reset(const uint64_t seed = 0);
+  uint64_t result() const;
+  void updateBytes(const void *data, const size_t numBytes);
+
+  template<typename CharT>
+  void update(const CharT *s, const size_t len)
+  {
+    updateBytes(s, len*sizeof(CharT));
+  }
+
+  // Hashes the characters as if mapped by csToLower()
+  template<typename CharT>
+  void updateI(const CharT *s, size_t len)
+  {
+    CharT folded[priv_hash::FOLD_SIZE];
+    while( len > 0 ) {
+      const size_t count = std::min(len, priv_hash::FOLD_SIZE);
+      std::char_traits<CharT>::copy(folded, s, count);
+      csToLower(folded, count);
+      updateBytes(folded, count*sizeof(CharT));
+      s   += count;
+      len -= count;
+    }
+  }
+
+private:
+  uint64_t _acc[4];
+  uint8_t  _buffer[32];
+  size_t   _bufferSize;
+  uint64_t _seed;
+  uint64_t _totalBytes;
+};
+
+template<typename CharT>
+inline uint64_t csHash(const CharT *s, const size_t len, const uint64_t seed = 0)
+{
+  return csHashBytes(s, len*sizeof(CharT), seed);
+}
+
+template<typename CharT>
+inline uint64_t csHash(const std::basic_string<CharT>& s, const uint64_t seed = 0)
+{
+  return csHashBytes(s.data(), s.size()*sizeof(CharT), seed);
+}
+
+template<typename CharT>
+inline uint64_t csHash(const std::basic_string_view<CharT>& s, const uint64_t seed = 0)
+{
+  return csHashBytes(s.data(), s.size()*sizeof(CharT), seed);
+}
+
+// Equals csHash() of the characters mapped by csToLower(); nothing is allocated.
+template<typename CharT>
+inline uint64_t csHashI(const CharT *s, const size_t len, const uint64_t seed = 0)
+{
+  if( len <= priv_hash::FOLD_SIZE ) {
+    CharT folded[priv_hash::FOLD_SIZE];
+    std::char_traits<CharT>::copy(folded, s, len);
+    csToLower(folded, len);
+    return csHashBytes(folded, len*sizeof(CharT), seed);
+  }
+
+  csHasher hasher(seed);
+  hasher.updateI(s, len);
+  return hasher.result();
+}
+
+template<typename CharT>
+inline uint64_t csHashI(const std::basic_string<CharT>& s, const uint64_t seed = 0)
+{
+  return csHashI(s.data(), s.size(), seed);
+}
+
+template<typename CharT>
+inline uint64_t csHashI(const std::basic_string_view<CharT>& s, const uint64_t seed = 0)
+{
+  return csHashI(s.data(), s.size(), seed);
+}
+
+// Function objects for (unordered) containers; being transparent, they
+// accept any string convertible to a view without creating a temporary.
+template<typename CharT>
+struct csStringHash {
+  typedef void is_transparent;
+
+  size_t operator()(const std::basic_string_view<CharT>& s) const
+  {
+    return size_t(csHash(s));
+  }
+};
+
+template<typename CharT>
+struct csStringHashI {
+  typedef void is_transparent;
+
+  size_t operator()(const std::basic_string_view<CharT>& s) const
+  {
+    return size_t(csHashI(s));
+  }
+};
+
+template<typename CharT>
+struct csStringEqualI {
+  typedef void is_transparent;
+
+  bool operator()(const std::basic_string_view<CharT>& a,
+                  const std::basic_string_view<CharT>& b) const
+  {
+    return a.size() == b.size()  &&
+        csBasicStringView<CharT>(a).compare(csBasicStringView<CharT>(b), true) == 0;
+  }
+};
+
+namespace std {
+
+#ifdef HAVE_CHAR
+  template<>
+  struct hash<csStringView> {
+    size_t operator()(const csStringView& s) const
+    {
+      return size_t(csHash(s.data(), s.size()));
+    }
+  };
+#endif
+
+#ifdef HAVE_WCHAR_T
+  template<>
+  struct hash<csWStringView> {
+    size_t operator()(const csWStringView& s) const
+    {
+      return size_t(csHash(s.data(), s.size()));
+    }
+  };
+#endif
+
+}; // namespace std
+
+#endif // __CSHASH_H__
@@ -51,4 +51,16 @@ struct CS_CORE2_EXPORT csLimits<uint32_t> {
   static uint32_t Max;
 };
 
+template<>
+struct CS_CORE2_EXPORT csLimits<int64_t> {
+  static int64_t Min;
+  static int64_t Max;
+};
+
+template<>
+struct CS_CORE2_EXPORT csLimits<uint64_t> {
+  static uint64_t Min;
+  static uint64_t Max;
+};
+
 #endif // __CSLIMITS_H__
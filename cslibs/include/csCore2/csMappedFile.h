@@ -0,0 +1,146 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSMAPPEDFILE_H__
+#define __CSMAPPEDFILE_H__
+
+#include <memory>
+#include <string_view>
+
+#include <csCore2/cscore2_config.h>
+
+namespace priv_mappedfile {
+
+  struct Mapping;
+
+}; // namespace priv_mappedfile
+
+enum csMapAccess {
+  csMapReadOnly = 0,
+  csMapReadWrite      // changes are written to the file
+};
+
+// Hints; ignored where the operating system does not support them.
+enum csMapFlag {
+  csMapPopulate  = 0x01, // read the whole file when mapping it
+  csMapHugePages = 0x02  // back the mapping with huge pages
+};
+
+enum csMapAdvice {
+  csMapAdviceNormal = 0,
+  csMapAdviceSequential,
+  csMapAdviceRandom,
+  csMapAdviceWillNeed,
+  csMapAdviceDontNeed
+};
+
+// Read-only range of a mapping. A view keeps the mapping alive, even after
+// its csMappedFile is closed; views may be copied to and read by any
+// thread.
+class CS_CORE2_EXPORT csMappedView {
+public:
+  csMappedView() noexcept;
+  ~csMappedView();
+
+  bool empty() const;
+  size_t size() const;
+  const uint8_t *data() const;
+
+  const uint8_t *begin() const;
+  const uint8_t *end() const;
+
+  std::string_view toStringView() const;
+
+  // Clamped to this view
+  csMappedView mid(const size_t offset, const size_t length = SIZE_MAX) const;
+
+  // Returns false if the hint is not supported.
+  bool advise(const csMapAdvice advice) const;
+
+private:
+  friend class csMappedFile;
+
+  csMappedView(const std::shared_ptr<priv_mappedfile::Mapping>& mapping,
+               const uint8_t *data, const size_t size) noexcept;
+
+  std::shared_ptr<priv_mappedfile::Mapping> _mapping;
+  const uint8_t *_data;
+  size_t _size;
+};
+
+// File mapped into memory, unmapped when the last csMappedFile or
+// csMappedView referencing it is gone. Opening an empty file succeeds
+// with a null data().
+class CS_CORE2_EXPORT csMappedFile {
+public:
+  csMappedFile() noexcept;
+  csMappedFile(csMappedFile&& other) noexcept;
+  ~csMappedFile();
+
+  csMappedFile& operator=(csMappedFile&& other) noexcept;
+
+  // flags are csMapFlag values
+  bool open(const wchar_t *filename, const csMapAccess access = csMapReadOnly,
+            const unsigned int flags = 0);
+  // Creates or truncates filename to size, mapped read-write
+  bool create(const wchar_t *filename, const size_t size, const unsigned int flags = 0);
+  void close();
+
+  bool isOpen() const;
+  bool isWritable() const;
+
+  size_t size() const;
+  const uint8_t *data() const;
+  // Null if not writable
+  uint8_t *writableData();
+
+  csMappedView view(const size_t offset = 0, const size_t length = SIZE_MAX) const;
+
+  // Returns false if the hint is not supported.
+  bool advise(const csMapAdvice advice,
+              const size_t offset = 0, const size_t length = SIZE_MAX) const;
+  // Writes changes back to the file; waits for the write unless async.
+  bool flush(const bool async = false);
+
+private:
+  csMappedFile(const csMappedFile&) = delete;
+  csMappedFile& operator=(const csMappedFile&) = delete;
+
+  bool map(const wchar_t *filename, const csMapAccess access, const unsigned int flags,
+           const bool isCreating, const size_t size);
+
+  std::shared_ptr<priv_mappedfile::Mapping> _mapping;
+  uint8_t *_data;
+  size_t _size;
+  bool _isWritable;
+};
+
+#endif // __CSMAPPEDFILE_H__
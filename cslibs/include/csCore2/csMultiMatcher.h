@@ -0,0 +1,120 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSMULTIMATCHER_H__
+#define __CSMULTIMATCHER_H__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringView.h>
+
+struct csMultiMatch {
+  size_t pattern; // as returned by csMultiMatcher::addPattern()
+  size_t offset;  // of the match's first character in the scanned stream
+};
+
+// Aho-Corasick automaton locating all occurrences of a set of patterns
+// in a single pass over the text.
+template<typename CharT>
+class csMultiMatcher {
+public:
+  typedef std::function<bool(const csMultiMatch& match)> MatchFunc;
+
+  // Position within a stream scanned in several chunks
+  struct Cursor {
+    Cursor()
+      : state(0)
+      , offset(0)
+    {
+    }
+
+    uint32_t state;
+    size_t   offset;
+  };
+
+  csMultiMatcher();
+  ~csMultiMatcher();
+
+  size_t addPattern(const csBasicStringView<CharT>& pattern);
+  void clear();
+  bool compile(const bool ignoreCase = false);
+
+  bool isCompiled() const;
+  size_t memoryUsage() const;
+  const std::basic_string<CharT>& pattern(const size_t i) const;
+  size_t patternCount() const;
+
+  bool containsAny(const csBasicStringView<CharT>& text) const;
+  std::vector<csMultiMatch> findAll(const csBasicStringView<CharT>& text) const;
+  // Returns false if func returned false.
+  bool scan(const CharT *data, const size_t len, Cursor *cursor,
+            const MatchFunc& func) const;
+
+private:
+  inline uint32_t classOf(const CharT ch) const;
+  inline uint32_t next(uint32_t state, const uint32_t cls) const;
+
+  std::vector<std::basic_string<CharT>> _patterns;
+  bool _ignoreCase;
+  bool _isCompiled;
+
+  // Alphabet; characters not used by any pattern map to class 0
+  std::vector<uint16_t> _narrowClass; // characters < 256, case folded
+  std::vector<CharT>    _wideChars;   // sorted
+  std::vector<uint16_t> _wideClass;
+  size_t _numClasses;
+
+  // States in breadth first order; 0 is the root. The first _numDense
+  // states have complete transitions, the others only their trie edges.
+  size_t _numDense;
+  std::vector<uint32_t> _denseNext; // _numClasses per state
+  std::vector<uint32_t> _edgeBegin;
+  std::vector<uint16_t> _edgeClass;
+  std::vector<uint32_t> _edgeTarget;
+  std::vector<uint32_t> _fail;
+  std::vector<uint32_t> _dictLink;  // next state on the fail chain with output
+  std::vector<uint32_t> _outBegin;
+  std::vector<uint32_t> _outPattern;
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csMultiMatcher<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csMultiMatcher<wchar_t>;
+#endif
+
+#endif // __CSMULTIMATCHER_H__
@@ -0,0 +1,131 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSNATURALSORT_H__
+#define __CSNATURALSORT_H__
+
+#include <string>
+#include <string_view>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringList.h>
+
+// Natural order compares the strings' code units, as unsigned values and
+// mapped by csToLower() if ignoreCase is set, except that a run of the
+// digits '0' to '9' compares as a whole by its numeric value, of any
+// length: "page2" < "page10". Runs of equal value compare by their count of
+// leading zeros, fewer first, if nothing else differs: "page7" < "page007".
+template<typename CharT>
+int csNaturalCmp(const CharT *s1, const size_t len1,
+                 const CharT *s2, const size_t len2,
+                 const bool ignoreCase = false);
+
+// Appends a binary sort key of s[0,len) to key; comparing two keys with
+// memcmp(), or std::string's operator<(), orders as csNaturalCmp() does.
+// Sorting by the keys parses each digit run only once.
+template<typename CharT>
+void csNaturalSortKey(std::string *key, const CharT *s, const size_t len,
+                      const bool ignoreCase = false);
+
+// Sorts list by natural order; the list's nodes are relinked and no string
+// is copied. Large lists are sorted using threadCount threads; < 1 selects
+// the number of hardware threads.
+template<class StringT>
+void csNaturalSort(csBasicStringList<StringT>& list, const bool ignoreCase = false,
+                   const int threadCount = 0);
+
+template<typename CharT>
+inline int csNaturalCmp(const std::basic_string_view<CharT>& a,
+                        const std::basic_string_view<CharT>& b,
+                        const bool ignoreCase = false)
+{
+  return csNaturalCmp(a.data(), a.size(), b.data(), b.size(), ignoreCase);
+}
+
+template<typename CharT>
+inline int csNaturalCmp(const std::basic_string<CharT>& a,
+                        const std::basic_string<CharT>& b,
+                        const bool ignoreCase = false)
+{
+  return csNaturalCmp(a.data(), a.size(), b.data(), b.size(), ignoreCase);
+}
+
+template<typename CharT>
+inline std::string csNaturalSortKey(const std::basic_string_view<CharT>& s,
+                                    const bool ignoreCase = false)
+{
+  std::string key;
+  csNaturalSortKey(&key, s.data(), s.size(), ignoreCase);
+  return key;
+}
+
+template<typename CharT>
+inline std::string csNaturalSortKey(const std::basic_string<CharT>& s,
+                                    const bool ignoreCase = false)
+{
+  std::string key;
+  csNaturalSortKey(&key, s.data(), s.size(), ignoreCase);
+  return key;
+}
+
+// Comparison object for the standard algorithms and containers
+template<typename CharT>
+struct csNaturalLess {
+  typedef void is_transparent;
+
+  explicit csNaturalLess(const bool ignoreCase = false)
+    : ignoreCase(ignoreCase)
+  {
+  }
+
+  bool operator()(const std::basic_string_view<CharT>& a,
+                  const std::basic_string_view<CharT>& b) const
+  {
+    return csNaturalCmp(a.data(), a.size(), b.data(), b.size(), ignoreCase) < 0;
+  }
+
+  bool ignoreCase;
+};
+
+#ifdef HAVE_CHAR
+extern template CS_CORE2_EXPORT int csNaturalCmp<char>(const char *s1, const size_t len1, const char *s2, const size_t len2, const bool ignoreCase);
+extern template CS_CORE2_EXPORT void csNaturalSortKey<char>(std::string *key, const char *s, const size_t len, const bool ignoreCase);
+extern template CS_CORE2_EXPORT void csNaturalSort<csString>(csBasicStringList<csString>& list, const bool ignoreCase, const int threadCount);
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template CS_CORE2_EXPORT int csNaturalCmp<wchar_t>(const wchar_t *s1, const size_t len1, const wchar_t *s2, const size_t len2, const bool ignoreCase);
+extern template CS_CORE2_EXPORT void csNaturalSortKey<wchar_t>(std::string *key, const wchar_t *s, const size_t len, const bool ignoreCase);
+extern template CS_CORE2_EXPORT void csNaturalSort<csWString>(csBasicStringList<csWString>& list, const bool ignoreCase, const int threadCount);
+#endif
+
+#endif // __CSNATURALSORT_H__
@@ -0,0 +1,106 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSNUMBERPARSER_H__
+#define __CSNUMBERPARSER_H__
+
+#include <string>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csAlphaNum.h>
+
+struct csNumberParseResult {
+  size_t count;     // of values stored
+  size_t position;  // of the first character not parsed; the buffer's length on success
+  csNumError error; // csNumValueTooLarge if the output's capacity is exhausted
+};
+
+// Parses buffers of numbers separated by runs of delimiter characters.
+// Delimiters are located 64 characters at a time by vector instructions;
+// large buffers are split at delimiters and parsed on several threads.
+// Each token must be a complete number as accepted by csFromChars().
+template<typename CharT>
+class csNumberParser {
+public:
+  // Default delimiters are ' ', '\t', '\r', '\n', ',' and ';'
+  csNumberParser(const CharT *delimiters = 0);
+  ~csNumberParser();
+
+  const std::basic_string<CharT>& delimiters() const;
+  void setDelimiters(const CharT *delimiters);
+
+  int threadCount() const;
+  // count < 1 selects the number of hardware threads
+  void setThreadCount(const int count);
+
+  // Number of tokens, regardless of their validity
+  size_t count(const CharT *first, const CharT *last) const;
+
+  // On error, values past count are unspecified.
+  csNumberParseResult parse(const CharT *first, const CharT *last, int32_t *values, const size_t capacity, const int base = 10) const;
+  csNumberParseResult parse(const CharT *first, const CharT *last, uint32_t *values, const size_t capacity, const int base = 10) const;
+  csNumberParseResult parse(const CharT *first, const CharT *last, int64_t *values, const size_t capacity, const int base = 10) const;
+  csNumberParseResult parse(const CharT *first, const CharT *last, uint64_t *values, const size_t capacity, const int base = 10) const;
+  csNumberParseResult parse(const CharT *first, const CharT *last, float *values, const size_t capacity) const;
+  csNumberParseResult parse(const CharT *first, const CharT *last, double *values, const size_t capacity) const;
+
+  // Sizes values to the number of values parsed; ContainerT is a
+  // contiguous container like std::vector<float> or QVector<float>.
+  template<typename ContainerT>
+  csNumberParseResult parseAll(const CharT *first, const CharT *last, ContainerT& values) const
+  {
+    typedef typename ContainerT::size_type size_type;
+    values.resize(size_type(count(first, last)));
+    const csNumberParseResult result = parse(first, last, values.data(), size_t(values.size()));
+    values.resize(size_type(result.count));
+    return result;
+  }
+
+private:
+  template<typename T, typename ParseFunc>
+  csNumberParseResult parseChunks(const CharT *first, const CharT *last,
+                                  T *values, const size_t capacity,
+                                  const ParseFunc& func) const;
+
+  std::basic_string<CharT> _delimiters;
+  int _threadCount;
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csNumberParser<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csNumberParser<wchar_t>;
+#endif
+
+#endif // __CSNUMBERPARSER_H__
@@ -33,48 +33,108 @@
 #define __CSSTRING_H__
 
 #include <string>
+#include <type_traits>
 
 #include <csCore2/cscore2_config.h>
 
+#include <csCore2/csAlphaNum.h>
+#include <csCore2/csHash.h>
+#include <csCore2/csStringSplit.h>
+#include <csCore2/csStringView.h>
+
 template<typename CharT>
 class csBasicString : public std::basic_string<CharT> {
 public:
   csBasicString();
   csBasicString(const csBasicString<CharT>& other);
+  csBasicString(csBasicString<CharT>&& other) noexcept;
 
   csBasicString(const size_t count, const CharT ch = CharT(0));
   csBasicString(const CharT *data);
   csBasicString(const std::basic_string<CharT>& other);
+  csBasicString(std::basic_string<CharT>&& other) noexcept;
+  explicit csBasicString(const csBasicStringView<CharT>& view);
 
   ~csBasicString();
 
   csBasicString<CharT>& operator=(const csBasicString<CharT>& other);
+  csBasicString<CharT>& operator=(csBasicString<CharT>&& other) noexcept;
 
   csBasicString<CharT>& operator=(const CharT *data);
   csBasicString<CharT>& operator=(const std::basic_string<CharT>& other);
+  csBasicString<CharT>& operator=(std::basic_string<CharT>&& other) noexcept;
 
   bool contains(const CharT ch, const bool ignoreCase = false) const;
+  bool contains(const csBasicStringView<CharT>& needle, const bool ignoreCase = false) const;
+
+  int count(const csBasicStringView<CharT>& needle, const bool ignoreCase = false) const;
 
   bool endsWith(const CharT ch, const bool ignoreCase = false) const;
   bool endsWith(const CharT *s, const bool ignoreCase = false) const;
   bool endsWith(const csBasicString<CharT>& other, const bool ignoreCase = false) const;
 
   int indexOf(const CharT ch, const int from = 0, const bool ignoreCase = false) const;
+  int indexOf(const csBasicStringView<CharT>& needle, const int from = 0, const bool ignoreCase = false) const;
 
   int lastIndexOf(const CharT ch, const int from = -1, const bool ignoreCase = false) const;
+  int lastIndexOf(const csBasicStringView<CharT>& needle, const int from = -1, const bool ignoreCase = false) const;
 
-  csBasicString<CharT> mid(const int pos, const int n = -1) const;
+  csBasicString<CharT> mid(const int pos, const int n = -1) const &;
+  csBasicString<CharT> mid(const int pos, const int n = -1) &&;
 
+  static csBasicString<CharT> number(const int32_t num, const int base = 10);
   static csBasicString<CharT> number(const uint32_t num, const int base = 10);
+  static csBasicString<CharT> number(const int64_t num, const int base = 10);
+  static csBasicString<CharT> number(const uint64_t num, const int base = 10);
+  // Any other integral type, e.g. long long or DWORD
+  template<typename T>
+  static typename std::enable_if<std::is_integral<T>::value,csBasicString<CharT>>::type
+  number(const T num, const int base = 10)
+  {
+    return number(typename csFixedInt<T>::type(num), base);
+  }
+  static csBasicString<CharT> number(const float num);
+  static csBasicString<CharT> number(const double num);
 
   csBasicString<CharT>& replace(const CharT before, const CharT after,
-                                const bool ignoreCase = false);
+                                const bool ignoreCase = false) &;
+  csBasicString<CharT> replace(const CharT before, const CharT after,
+                               const bool ignoreCase = false) &&;
+
+  // Replaces non-overlapping occurrences from left to right; the result is
+  // allocated at most once. An empty before leaves the string unchanged.
+  csBasicString<CharT>& replaceAll(const csBasicStringView<CharT>& before,
+                                   const csBasicStringView<CharT>& after,
+                                   const bool ignoreCase = false) &;
+  csBasicString<CharT> replaceAll(const csBasicStringView<CharT>& before,
+                                  const csBasicStringView<CharT>& after,
+                                  const bool ignoreCase = false) &&;
+
+  // The tokens are views of this string; temporaries cannot be split.
+  csBasicStringSplit<CharT> split(const CharT delimiter,
+                                  const csSplitBehavior behavior = csKeepEmptyParts) const &;
+  csBasicStringSplit<CharT> split(const csBasicStringView<CharT>& delimiter,
+                                  const csSplitBehavior behavior = csKeepEmptyParts) const &;
+  csBasicStringSplit<CharT> splitAny(const csBasicStringView<CharT>& delimiters,
+                                     const csSplitBehavior behavior = csKeepEmptyParts) const &;
+  csBasicStringSplit<CharT> split(const CharT, const csSplitBehavior = csKeepEmptyParts) && = delete;
+  csBasicStringSplit<CharT> split(const csBasicStringView<CharT>&,
+                                  const csSplitBehavior = csKeepEmptyParts) && = delete;
+  csBasicStringSplit<CharT> splitAny(const csBasicStringView<CharT>&,
+                                     const csSplitBehavior = csKeepEmptyParts) && = delete;
 
   bool startsWith(const CharT ch, const bool ignoreCase = false) const;
   bool startsWith(const CharT *s, const bool ignoreCase = false) const;
   bool startsWith(const csBasicString<CharT>& other, const bool ignoreCase = false) const;
 
+  int32_t toInt(bool *ok = 0, const int base = 10) const;
   uint32_t toUInt(bool *ok = 0, const int base = 10) const;
+  int64_t toInt64(bool *ok = 0, const int base = 10) const;
+  uint64_t toUInt64(bool *ok = 0, const int base = 10) const;
+  float toFloat(bool *ok = 0) const;
+  double toDouble(bool *ok = 0) const;
+
+  csBasicStringView<CharT> view() const;
 };
 
 #ifdef HAVE_CHAR
@@ -89,4 +149,28 @@ extern template class CS_CORE2_EXPORT csBasicString<wchar_t>;
 typedef csBasicString<wchar_t> csWString;
 #endif
 
+namespace std {
+
+#ifdef HAVE_CHAR
+  template<>
+  struct hash<csString> {
+    size_t operator()(const csString& s) const
+    {
+      return size_t(csHash(s.data(), s.size()));
+    }
+  };
+#endif
+
+#ifdef HAVE_WCHAR_T
+  template<>
+  struct hash<csWString> {
+    size_t operator()(const csWString& s) const
+    {
+      return size_t(csHash(s.data(), s.size()));
+    }
+  };
+#endif
+
+}; // namespace std
+
 #endif // __CSSTRING_H__
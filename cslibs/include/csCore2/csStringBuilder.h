@@ -0,0 +1,118 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSSTRINGBUILDER_H__
+#define __CSSTRINGBUILDER_H__
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csAlphaNum.h>
+#include <csCore2/csString.h>
+
+// Appends in amortized constant time. Until the first overflow, characters
+// are written to the optional caller-provided buffer; afterwards storage
+// grows geometrically on the heap. take() hands the heap storage to the
+// resulting string without copying it.
+template<typename CharT>
+class csBasicStringBuilder {
+public:
+  csBasicStringBuilder();
+  explicit csBasicStringBuilder(const size_t capacity);
+  // buffer holds size characters, including the terminating NUL
+  csBasicStringBuilder(CharT *buffer, const size_t size);
+  csBasicStringBuilder(csBasicStringBuilder<CharT>&& other) noexcept;
+  ~csBasicStringBuilder();
+
+  csBasicStringBuilder<CharT>& operator=(csBasicStringBuilder<CharT>&& other) noexcept;
+
+  csBasicStringBuilder<CharT>& append(const CharT ch);
+  csBasicStringBuilder<CharT>& append(const size_t count, const CharT ch);
+  csBasicStringBuilder<CharT>& append(const CharT *s);
+  csBasicStringBuilder<CharT>& append(const CharT *s, const size_t count);
+  csBasicStringBuilder<CharT>& append(const csBasicString<CharT>& s);
+  csBasicStringBuilder<CharT>& append(const csBasicStringView<CharT>& s);
+
+  csBasicStringBuilder<CharT>& appendNumber(const int32_t num, const int base = 10);
+  csBasicStringBuilder<CharT>& appendNumber(const uint32_t num, const int base = 10);
+  csBasicStringBuilder<CharT>& appendNumber(const int64_t num, const int base = 10);
+  csBasicStringBuilder<CharT>& appendNumber(const uint64_t num, const int base = 10);
+  // Any other integral type, e.g. long long or DWORD
+  template<typename T>
+  typename std::enable_if<std::is_integral<T>::value,csBasicStringBuilder<CharT>&>::type
+  appendNumber(const T num, const int base = 10)
+  {
+    return appendNumber(typename csFixedInt<T>::type(num), base);
+  }
+  csBasicStringBuilder<CharT>& appendNumber(const float num);
+  csBasicStringBuilder<CharT>& appendNumber(const double num);
+
+  const CharT *c_str() const;
+  size_t capacity() const;
+  void clear();
+  bool empty() const;
+  void reserve(const size_t capacity);
+  size_t size() const;
+  csBasicStringView<CharT> view() const;
+
+  // Leaves the builder empty; its inline buffer, if any, is kept
+  csBasicString<CharT> take();
+
+private:
+  csBasicStringBuilder(const csBasicStringBuilder<CharT>&) = delete;
+  csBasicStringBuilder<CharT>& operator=(const csBasicStringBuilder<CharT>&) = delete;
+
+  csBasicStringBuilder<CharT>& commit(const CharT *first, const csToCharsResult<CharT>& result);
+  inline CharT *makeRoom(const size_t count);
+  inline CharT *numberBuffer(CharT *number);
+  void reallocate(const size_t capacity);
+  void reset();
+
+  CharT *_data;     // either _inline or _heap.data()
+  size_t _size;
+  size_t _capacity; // excluding the terminating NUL
+  CharT *_inline;
+  size_t _inlineCapacity;
+  csBasicString<CharT> _heap; // _capacity characters are in use, if _data points here
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csBasicStringBuilder<char>;
+
+typedef csBasicStringBuilder<char> csStringBuilder;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csBasicStringBuilder<wchar_t>;
+
+typedef csBasicStringBuilder<wchar_t> csWStringBuilder;
+#endif
+
+#endif // __CSSTRINGBUILDER_H__
@@ -64,6 +64,11 @@ CharT *csStringNCpy(CharT *dest, const CharT *src, const size_t maxsize);
 template<typename CharT>
 size_t csStringNLen(const CharT *s, const size_t maxsize);
 
+// Like csStringCpy(), but returns a pointer to the terminating null of dest;
+// use it to chain concatenations without rescanning dest.
+template<typename CharT>
+CharT *csStringPCpy(CharT *dest, const CharT *src);
+
 #ifdef HAVE_CHAR
 extern template CS_CORE2_EXPORT char *csStringCat<char>(char *dest, const char *src);
 extern template CS_CORE2_EXPORT int csStringCmp<char>(const char *s1, const char *s2);
@@ -75,6 +80,7 @@ extern template CS_CORE2_EXPORT int csStringNCmp<char>(const char *s1, const cha
 extern template CS_CORE2_EXPORT int csStringNCmpI<char>(const char *s1, const char *s2, const size_t maxsize);
 extern template CS_CORE2_EXPORT char *csStringNCpy<char>(char *dest, const char *src, const size_t maxsize);
 extern template CS_CORE2_EXPORT size_t csStringNLen<char>(const char *s, const size_t maxsize);
+extern template CS_CORE2_EXPORT char *csStringPCpy<char>(char *dest, const char *src);
 #endif
 
 #ifdef HAVE_WCHAR_T
@@ -88,6 +94,7 @@ extern template CS_CORE2_EXPORT int csStringNCmp<wchar_t>(const wchar_t *s1, con
 extern template CS_CORE2_EXPORT int csStringNCmpI<wchar_t>(const wchar_t *s1, const wchar_t *s2, const size_t maxsize);
 extern template CS_CORE2_EXPORT wchar_t *csStringNCpy<wchar_t>(wchar_t *dest, const wchar_t *src, const size_t maxsize);
 extern template CS_CORE2_EXPORT size_t csStringNLen<wchar_t>(const wchar_t *s, const size_t maxsize);
+extern template CS_CORE2_EXPORT wchar_t *csStringPCpy<wchar_t>(wchar_t *dest, const wchar_t *src);
 #endif
 
 #endif // __CSSTRINGLIB_H__
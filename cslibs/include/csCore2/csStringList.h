@@ -33,6 +33,7 @@
 #define __CSSTRINGLIST_H__
 
 #include <list>
+#include <type_traits>
 
 #include <csCore2/cscore2_config.h>
 
@@ -43,9 +44,14 @@ class csBasicStringList : public std::list<StringT> {
 public:
   csBasicStringList();
   csBasicStringList(const csBasicStringList<StringT>& other);
+  // NOTE: MSVC's std::list allocates a new sentinel node when moved from.
+  csBasicStringList(csBasicStringList<StringT>&& other)
+    noexcept(std::is_nothrow_move_constructible<std::list<StringT>>::value);
   ~csBasicStringList();
 
   csBasicStringList& operator=(const csBasicStringList<StringT>& other);
+  csBasicStringList& operator=(csBasicStringList<StringT>&& other)
+    noexcept(std::is_nothrow_move_assignable<std::list<StringT>>::value);
 };
 
 #ifdef HAVE_CHAR
@@ -0,0 +1,98 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSSTRINGPOOL_H__
+#define __CSSTRINGPOOL_H__
+
+#include <memory>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringView.h>
+
+// Equal strings interned by the same pool have equal handles.
+typedef uint32_t csStringHandle;
+
+const csStringHandle csInvalidStringHandle = 0;
+
+struct csStringPoolStatistics {
+  size_t numStrings;
+  size_t numChars;   // including the terminating NULs
+  size_t arenaBytes; // allocated for the characters
+  size_t indexBytes; // allocated for the entries & the hash tables
+};
+
+// Thread-safe store holding one copy of every string inserted; the
+// strings never move, so views stay valid until clear() or destruction.
+// Every shard is guarded by its own lock and owns the strings hashing
+// to it; use several shards when many threads insert concurrently.
+template<typename CharT>
+class csStringPool {
+public:
+  // numShards is rounded up to a power of 2; < 1 selects the number of
+  // hardware threads
+  explicit csStringPool(const int numShards = 1);
+  ~csStringPool();
+
+  csStringPool(const csStringPool<CharT>&) = delete;
+  csStringPool<CharT>& operator=(const csStringPool<CharT>&) = delete;
+
+  // Invalidates all handles & views; NOT safe to call concurrently.
+  void clear();
+  // Returns csInvalidStringHandle if s was not inserted before.
+  csStringHandle find(const csBasicStringView<CharT>& s) const;
+  // Returns csInvalidStringHandle if the pool is full.
+  csStringHandle insert(const csBasicStringView<CharT>& s);
+
+  int numShards() const;
+  size_t size() const;
+  csStringPoolStatistics statistics() const;
+
+  // NUL terminated; empty for an invalid handle
+  const CharT *c_str(const csStringHandle h) const;
+  csBasicStringView<CharT> value(const csStringHandle h) const;
+
+private:
+  struct Shard;
+
+  std::unique_ptr<Shard[]> _shards;
+  int _shardBits;
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csStringPool<char>;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csStringPool<wchar_t>;
+#endif
+
+#endif // __CSSTRINGPOOL_H__
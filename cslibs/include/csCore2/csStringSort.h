@@ -0,0 +1,65 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSSTRINGSORT_H__
+#define __CSSTRINGSORT_H__
+
+#include <vector>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringList.h>
+
+// Sorts like std::sort() with csStringCmp() (csStringCmpI()) as comparison,
+// i.e. the order of equal strings is unspecified. A multikey quicksort
+// compares each common prefix only once, reading several characters at a
+// time. Large inputs are sorted using threadCount threads; < 1 selects the
+// number of hardware threads.
+template<typename CharT>
+void csStringSort(std::vector<csBasicString<CharT>>& strings, const bool ignoreCase = false,
+                  const int threadCount = 0);
+
+// The list's nodes are relinked; no string is copied.
+template<class StringT>
+void csStringSort(csBasicStringList<StringT>& list, const bool ignoreCase = false,
+                  const int threadCount = 0);
+
+#ifdef HAVE_CHAR
+extern template CS_CORE2_EXPORT void csStringSort<char>(std::vector<csBasicString<char>>& strings, const bool ignoreCase, const int threadCount);
+extern template CS_CORE2_EXPORT void csStringSort<csString>(csBasicStringList<csString>& list, const bool ignoreCase, const int threadCount);
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template CS_CORE2_EXPORT void csStringSort<wchar_t>(std::vector<csBasicString<wchar_t>>& strings, const bool ignoreCase, const int threadCount);
+extern template CS_CORE2_EXPORT void csStringSort<csWString>(csBasicStringList<csWString>& list, const bool ignoreCase, const int threadCount);
+#endif
+
+#endif // __CSSTRINGSORT_H__
@@ -0,0 +1,178 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSSTRINGSPLIT_H__
+#define __CSSTRINGSPLIT_H__
+
+#include <iterator>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringTable.h>
+#include <csCore2/csStringView.h>
+
+enum csSplitBehavior {
+  csKeepEmptyParts = 0,
+  csSkipEmptyParts
+};
+
+// Lazily splits a string at a character, any character of a set, or a
+// substring; neither splitting nor iterating allocates. Tokens are views
+// of the split string, which (like a delimiter set or substring) must
+// outlive the split. An empty set or substring yields the string as is.
+template<typename CharT>
+class csBasicStringSplit {
+public:
+  class const_iterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef csBasicStringView<CharT>  value_type;
+    typedef ptrdiff_t                 difference_type;
+    typedef const value_type         *pointer;
+    typedef const value_type&         reference;
+
+    const_iterator()
+      : _split(0)
+      , _next(0)
+      , _token()
+      , _atEnd(true)
+    {
+    }
+
+    explicit const_iterator(const csBasicStringSplit<CharT> *split)
+      : _split(split)
+      , _next(0)
+      , _token()
+      , _atEnd(false)
+    {
+      operator++();
+    }
+
+    reference operator*() const
+    {
+      return _token;
+    }
+
+    pointer operator->() const
+    {
+      return &_token;
+    }
+
+    const_iterator& operator++()
+    {
+      _atEnd = !_split->nextToken(&_next, &_token);
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const const_iterator result(*this);
+      operator++();
+      return result;
+    }
+
+    bool operator==(const const_iterator& other) const
+    {
+      return _atEnd  ||  other._atEnd
+          ? _atEnd == other._atEnd
+          : _token.data() == other._token.data()  &&  _token.size() == other._token.size();
+    }
+
+    bool operator!=(const const_iterator& other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    const csBasicStringSplit<CharT> *_split;
+    size_t _next; // where the search for the next token starts
+    csBasicStringView<CharT> _token;
+    bool _atEnd;
+  };
+
+  csBasicStringSplit(const csBasicStringView<CharT>& s, const CharT delimiter,
+                     const csSplitBehavior behavior = csKeepEmptyParts);
+  csBasicStringSplit(const csBasicStringView<CharT>& s, const csBasicStringView<CharT>& delimiter,
+                     const csSplitBehavior behavior = csKeepEmptyParts);
+  ~csBasicStringSplit();
+
+  static csBasicStringSplit<CharT> anyOf(const csBasicStringView<CharT>& s,
+                                         const csBasicStringView<CharT>& delimiters,
+                                         const csSplitBehavior behavior = csKeepEmptyParts);
+
+  const_iterator begin() const
+  {
+    return const_iterator(this);
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator();
+  }
+
+  // Copies the tokens into contiguous storage owned by the result
+  csBasicStringTable<CharT> collect() const;
+
+private:
+  enum DelimiterType {
+    Character = 0,
+    AnyOf,
+    Substring
+  };
+
+  csBasicStringSplit(const csBasicStringView<CharT>& s, const csBasicStringView<CharT>& delimiter,
+                     const DelimiterType type, const csSplitBehavior behavior);
+
+  size_t findDelimiter(const size_t from) const;
+  size_t findNonDelimiter(const size_t from) const;
+  // Advances *from past the token stored in *token; false after the last token
+  bool nextToken(size_t *from, csBasicStringView<CharT> *token) const;
+
+  csBasicStringView<CharT> _s;
+  csBasicStringView<CharT> _delimiter; // set or substring
+  CharT _ch;
+  DelimiterType _type;
+  csSplitBehavior _behavior;
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csBasicStringSplit<char>;
+
+typedef csBasicStringSplit<char> csStringSplit;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csBasicStringSplit<wchar_t>;
+
+typedef csBasicStringSplit<wchar_t> csWStringSplit;
+#endif
+
+#endif // __CSSTRINGSPLIT_H__
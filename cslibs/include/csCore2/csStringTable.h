@@ -0,0 +1,240 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSSTRINGTABLE_H__
+#define __CSSTRINGTABLE_H__
+
+#include <iterator>
+#include <vector>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csStringView.h>
+
+// Sequence of strings stored back to back, each NUL terminated, in one
+// buffer; entries are addressed by their offsets. Compared to
+// csBasicStringList, appending a string allocates only when the buffer
+// grows, and iterating reads memory sequentially.
+template<typename CharT>
+class csBasicStringTable {
+public:
+  class const_iterator {
+  public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef csBasicStringView<CharT>        value_type;
+    typedef ptrdiff_t                       difference_type;
+    typedef const value_type               *pointer;
+    typedef value_type                      reference;
+
+    const_iterator()
+      : _table(0)
+      , _index(0)
+    {
+    }
+
+    const_iterator(const csBasicStringTable<CharT> *table, const size_t index)
+      : _table(table)
+      , _index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+      return _table->operator[](_index);
+    }
+
+    reference operator[](const difference_type n) const
+    {
+      return _table->operator[](size_t(difference_type(_index) + n));
+    }
+
+    const_iterator& operator++()
+    {
+      _index++;
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const const_iterator result(*this);
+      _index++;
+      return result;
+    }
+
+    const_iterator& operator--()
+    {
+      _index--;
+      return *this;
+    }
+
+    const_iterator operator--(int)
+    {
+      const const_iterator result(*this);
+      _index--;
+      return result;
+    }
+
+    const_iterator& operator+=(const difference_type n)
+    {
+      _index = size_t(difference_type(_index) + n);
+      return *this;
+    }
+
+    const_iterator& operator-=(const difference_type n)
+    {
+      _index = size_t(difference_type(_index) - n);
+      return *this;
+    }
+
+    const_iterator operator+(const difference_type n) const
+    {
+      return const_iterator(_table, size_t(difference_type(_index) + n));
+    }
+
+    const_iterator operator-(const difference_type n) const
+    {
+      return const_iterator(_table, size_t(difference_type(_index) - n));
+    }
+
+    difference_type operator-(const const_iterator& other) const
+    {
+      return difference_type(_index) - difference_type(other._index);
+    }
+
+    bool operator==(const const_iterator& other) const
+    {
+      return _index == other._index;
+    }
+
+    bool operator!=(const const_iterator& other) const
+    {
+      return _index != other._index;
+    }
+
+    bool operator<(const const_iterator& other) const
+    {
+      return _index < other._index;
+    }
+
+  private:
+    const csBasicStringTable<CharT> *_table;
+    size_t _index;
+  };
+
+  csBasicStringTable();
+  csBasicStringTable(const csBasicStringTable<CharT>& other);
+  csBasicStringTable(csBasicStringTable<CharT>&& other) noexcept;
+  ~csBasicStringTable();
+
+  csBasicStringTable<CharT>& operator=(const csBasicStringTable<CharT>& other);
+  csBasicStringTable<CharT>& operator=(csBasicStringTable<CharT>&& other) noexcept;
+
+  void append(const csBasicStringView<CharT>& s);
+  void append(const CharT *s);
+  void clear();
+  // Capacity for count strings of length characters in total
+  void reserve(const size_t count, const size_t length);
+  // Reorders the entries only; the characters stay in place. Orders like
+  // csStringSort(); large tables are sorted using threadCount threads.
+  void sort(const bool ignoreCase = false, const int threadCount = 1);
+  void swap(csBasicStringTable<CharT>& other) noexcept;
+  // Keeps the first count entries
+  void truncate(const size_t count);
+
+  // Characters stored, including the terminating NULs
+  size_t numChars() const
+  {
+    return _chars.size();
+  }
+
+  size_t size() const
+  {
+    return _entries.size();
+  }
+
+  bool empty() const
+  {
+    return _entries.empty();
+  }
+
+  const CharT *c_str(const size_t i) const
+  {
+    return _chars.data() + _entries[i].offset;
+  }
+
+  csBasicStringView<CharT> operator[](const size_t i) const
+  {
+    return csBasicStringView<CharT>(_chars.data() + _entries[i].offset, _entries[i].size);
+  }
+
+  csBasicStringView<CharT> front() const
+  {
+    return operator[](0);
+  }
+
+  csBasicStringView<CharT> back() const
+  {
+    return operator[](size() - 1);
+  }
+
+  const_iterator begin() const
+  {
+    return const_iterator(this, 0);
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator(this, size());
+  }
+
+private:
+  struct Entry {
+    size_t offset;
+    size_t size;
+  };
+
+  std::vector<CharT> _chars;
+  std::vector<Entry> _entries;
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csBasicStringTable<char>;
+
+typedef csBasicStringTable<char> csStringTable;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csBasicStringTable<wchar_t>;
+
+typedef csBasicStringTable<wchar_t> csWStringTable;
+#endif
+
+#endif // __CSSTRINGTABLE_H__
@@ -0,0 +1,88 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSSTRINGVIEW_H__
+#define __CSSTRINGVIEW_H__
+
+#include <string>
+#include <string_view>
+
+#include <csCore2/cscore2_config.h>
+
+template<typename CharT>
+class csBasicStringView : public std::basic_string_view<CharT> {
+public:
+  csBasicStringView() noexcept;
+  csBasicStringView(const CharT *data);
+  csBasicStringView(const CharT *data, const size_t count) noexcept;
+  csBasicStringView(const std::basic_string<CharT>& s) noexcept;
+  csBasicStringView(const std::basic_string_view<CharT>& other) noexcept;
+
+  using std::basic_string_view<CharT>::compare;
+  int compare(const csBasicStringView<CharT>& other, const bool ignoreCase) const;
+
+  bool contains(const CharT ch, const bool ignoreCase = false) const;
+  bool contains(const csBasicStringView<CharT>& needle, const bool ignoreCase = false) const;
+
+  int count(const csBasicStringView<CharT>& needle, const bool ignoreCase = false) const;
+
+  bool endsWith(const CharT ch, const bool ignoreCase = false) const;
+  bool endsWith(const csBasicStringView<CharT>& other, const bool ignoreCase = false) const;
+
+  int indexOf(const CharT ch, const int from = 0, const bool ignoreCase = false) const;
+  int indexOf(const csBasicStringView<CharT>& needle, const int from = 0, const bool ignoreCase = false) const;
+
+  int lastIndexOf(const CharT ch, const int from = -1, const bool ignoreCase = false) const;
+  int lastIndexOf(const csBasicStringView<CharT>& needle, const int from = -1, const bool ignoreCase = false) const;
+
+  csBasicStringView<CharT> left(const int n) const;
+  csBasicStringView<CharT> mid(const int pos, const int n = -1) const;
+  csBasicStringView<CharT> right(const int n) const;
+
+  bool startsWith(const CharT ch, const bool ignoreCase = false) const;
+  bool startsWith(const csBasicStringView<CharT>& other, const bool ignoreCase = false) const;
+
+  csBasicStringView<CharT> trimmed() const;
+};
+
+#ifdef HAVE_CHAR
+extern template class CS_CORE2_EXPORT csBasicStringView<char>;
+
+typedef csBasicStringView<char> csStringView;
+#endif
+
+#ifdef HAVE_WCHAR_T
+extern template class CS_CORE2_EXPORT csBasicStringView<wchar_t>;
+
+typedef csBasicStringView<wchar_t> csWStringView;
+#endif
+
+#endif // __CSSTRINGVIEW_H__
@@ -0,0 +1,110 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#ifndef __CSUTF_H__
+#define __CSUTF_H__
+
+#include <string>
+
+#include <csCore2/cscore2_config.h>
+
+#include <csCore2/csString.h>
+#include <csCore2/csStringView.h>
+
+enum csUtfError {
+  csUtfNoError = 0,
+  csUtfInvalidSequence, // ill-formed input, e.g. overlong or unpaired surrogate
+  csUtfIncomplete,      // input ends within a sequence
+  csUtfOutputTooSmall   // output cannot hold the next character
+};
+
+struct csUtfResult {
+  size_t read;      // input code units consumed; on error, the offending character
+  size_t written;   // output code units written
+  csUtfError error;
+};
+
+// Transcodes [in,in+len) into [out,out+capacity) without a terminating
+// NUL, up to the first error. Input is validated strictly: overlong
+// sequences, surrogates and code points beyond U+10FFFF are rejected.
+//
+// Sufficient capacities:
+//   UTF-8  -> UTF-16/32: len
+//   UTF-16 -> UTF-8:     3*len
+//   UTF-32 -> UTF-8:     4*len
+//   UTF-16 <-> UTF-32:   2*len (UTF-32 -> UTF-16), len (otherwise)
+
+CS_CORE2_EXPORT csUtfResult csUtf8ToUtf16(const char *in, const size_t len,
+                                          char16_t *out, const size_t capacity);
+CS_CORE2_EXPORT csUtfResult csUtf8ToUtf32(const char *in, const size_t len,
+                                          char32_t *out, const size_t capacity);
+
+CS_CORE2_EXPORT csUtfResult csUtf16ToUtf8(const char16_t *in, const size_t len,
+                                          char *out, const size_t capacity);
+CS_CORE2_EXPORT csUtfResult csUtf16ToUtf32(const char16_t *in, const size_t len,
+                                           char32_t *out, const size_t capacity);
+
+CS_CORE2_EXPORT csUtfResult csUtf32ToUtf8(const char32_t *in, const size_t len,
+                                          char *out, const size_t capacity);
+CS_CORE2_EXPORT csUtfResult csUtf32ToUtf16(const char32_t *in, const size_t len,
+                                           char16_t *out, const size_t capacity);
+
+// Returns the length of the valid prefix; len if s is valid.
+CS_CORE2_EXPORT size_t csValidUtf8Length(const char *s, const size_t len);
+CS_CORE2_EXPORT size_t csValidUtf16Length(const char16_t *s, const size_t len);
+
+// wchar_t holds UTF-16 on Windows and UTF-32 elsewhere
+
+inline csUtfResult csUtf8ToWide(const char *in, const size_t len,
+                                wchar_t *out, const size_t capacity)
+{
+  return sizeof(wchar_t) == 2
+      ? csUtf8ToUtf16(in, len, reinterpret_cast<char16_t*>(out), capacity)
+      : csUtf8ToUtf32(in, len, reinterpret_cast<char32_t*>(out), capacity);
+}
+
+inline csUtfResult csWideToUtf8(const wchar_t *in, const size_t len,
+                                char *out, const size_t capacity)
+{
+  return sizeof(wchar_t) == 2
+      ? csUtf16ToUtf8(reinterpret_cast<const char16_t*>(in), len, out, capacity)
+      : csUtf32ToUtf8(reinterpret_cast<const char32_t*>(in), len, out, capacity);
+}
+
+#ifdef HAVE_WCHAR_T
+
+// Converts up to the first error; result is optional.
+CS_CORE2_EXPORT csWString csFromUtf8(const std::string_view& s, csUtfResult *result = 0);
+CS_CORE2_EXPORT std::string csToUtf8(const csWStringView& s, csUtfResult *result = 0);
+
+#endif
+
+#endif // __CSUTF_H__
@@ -38,11 +38,20 @@
  * Compiler *****************************************************************
  ****************************************************************************/
 
-#if _MSC_VER >= 1700 // Microsoft VisualC++ 2012
+#if _MSC_VER >= 1900 // Microsoft VisualC++ 2015
 # include <cstddef>
 # include <cstdint>
 # define CS_DECL_EXPORT  __declspec(dllexport)
 # define CS_DECL_IMPORT  __declspec(dllimport)
+# define CS_DECL_EXPORT_INSTANTIATION  CS_DECL_EXPORT
+#elif defined(__GNUC__) || defined(__clang__)
+# include <cstddef>
+# include <cstdint>
+# define CS_DECL_EXPORT  __attribute__((visibility("default")))
+# define CS_DECL_IMPORT  __attribute__((visibility("default")))
+// NOTE: The visibility is taken from the 'extern template' declaration;
+//       GCC ignores attributes on the instantiation's definition.
+# define CS_DECL_EXPORT_INSTANTIATION
 #else
 # error Compiler detection failed!
 #endif
@@ -53,6 +62,12 @@
 
 #if defined(WIN32) || defined(WIN64)
 # define CS_OS_WINDOWS
+#elif defined(__linux__)
+# define CS_OS_LINUX
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+# define CS_OS_POSIX
 #endif
 
 /****************************************************************************
@@ -61,6 +76,8 @@
 
 #ifdef CS_BUILD_CORE2_LIB
 # define CS_CORE2_EXPORT  CS_DECL_EXPORT
+// Explicit instantiation definitions of exported class templates
+# define CS_CORE2_EXPORT_INSTANTIATION  CS_DECL_EXPORT_INSTANTIATION
 #else
 # define CS_CORE2_EXPORT  CS_DECL_IMPORT
 #endif
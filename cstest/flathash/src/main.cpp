@@ -0,0 +1,167 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <csCore2/csFlatHash.h>
+#include <csCore2/csString.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+template<typename MapT>
+bool benchmark(const char *title, const std::vector<csWString>& keys,
+               const std::vector<csWString>& misses)
+{
+  MapT map;
+
+  Clock::time_point start = Clock::now();
+  for(size_t i = 0; i < keys.size(); i++) {
+    map[keys[i]] = i;
+  }
+  const double insertSecs = secondsSince(start);
+
+  start = Clock::now();
+  size_t sum = 0;
+  for(const csWString& key : keys) {
+    sum += map.find(key)->second;
+  }
+  const double hitSecs = secondsSince(start);
+
+  start = Clock::now();
+  size_t numFound = 0;
+  for(const csWString& key : misses) {
+    numFound += map.count(key);
+  }
+  const double missSecs = secondsSince(start);
+
+  start = Clock::now();
+  size_t numIterated = 0;
+  for(const auto& entry : map) {
+    numIterated += entry.second & 1;
+  }
+  const double iterateSecs = secondsSince(start);
+
+  if( sum != keys.size()*(keys.size() - 1)/2  ||  numFound != 0  ||
+      numIterated != keys.size()/2 ) {
+    fprintf(stderr, "ERROR: %s mismatch!\n", title);
+    return false;
+  }
+
+  printf("%-20s insert %7.1f ms, hit %7.1f ms, miss %7.1f ms, iterate %6.1f ms\n", title,
+         insertSecs*1e3, hitSecs*1e3, missSecs*1e3, iterateSecs*1e3);
+
+  return true;
+}
+
+// Case-insensitive keys with embedded NULs; equality must see the whole key
+bool checkEmbeddedNul()
+{
+  const csWString key1(csWStringView(L"a\0b", 3));
+  const csWString key2(csWStringView(L"A\0B", 3));
+  const csWString key3(csWStringView(L"a\0c", 3));
+
+  csFlatHashSet<csWString,csStringHashI<wchar_t>,csStringEqualI<wchar_t>> set;
+  set.insert(key1);
+  set.insert(key2);
+  set.insert(key3);
+
+  if( set.size() != 2  ||
+      csWStringView(key1).compare(key3, false) >= 0  ||
+      csWStringView(key1).compare(key3, true)  >= 0 ) {
+    fprintf(stderr, "ERROR: Embedded NUL mismatch!\n");
+    return false;
+  }
+
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_KEYS = 1000000;
+
+  if( !checkEmbeddedNul() ) {
+    return EXIT_FAILURE;
+  }
+
+  // Paths of varying length
+  std::mt19937 rng(42);
+  std::vector<csWString> keys;
+  std::vector<csWString> misses;
+  keys.reserve(NUM_KEYS);
+  misses.reserve(NUM_KEYS);
+  for(size_t i = 0; i < NUM_KEYS; i++) {
+    const csWString dir = L"C:\\Users\\cschmidt\\Documents\\project"
+        + csWString::number(rng() % 1000) + L"\\";
+    keys.push_back(dir + L"file" + csWString::number(i) + L".txt");
+    misses.push_back(dir + L"file" + csWString::number(i) + L".dat");
+  }
+
+  std::shuffle(misses.begin(), misses.end(), rng);
+
+  if( !benchmark<std::unordered_map<csWString,size_t>>("std::unordered_map", keys, misses) ||
+      !benchmark<csFlatHashMap<csWString,size_t>>("csFlatHashMap", keys, misses) ) {
+    return EXIT_FAILURE;
+  }
+
+  // Heterogeneous lookup; no temporary csWString
+  csFlatHashMap<csWString,size_t> map;
+  for(size_t i = 0; i < keys.size(); i++) {
+    map[keys[i]] = i;
+  }
+
+  Clock::time_point start = Clock::now();
+  size_t sum = 0;
+  for(const csWString& key : keys) {
+    sum += map.find(key.c_str())->second;
+  }
+  const double pointerSecs = secondsSince(start);
+
+  if( sum != keys.size()*(keys.size() - 1)/2 ) {
+    fprintf(stderr, "ERROR: find(const wchar_t*) mismatch!\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("%-20s hit %7.1f ms\n", "find(const wchar_t*)", pointerSecs*1e3);
+
+  return EXIT_SUCCESS;
+}
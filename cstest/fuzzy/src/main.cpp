@@ -0,0 +1,100 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+
+#include <csCore2/csFuzzyMatcher.h>
+#include <csCore2/csString.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_CANDIDATES = 200000;
+  const size_t MAX_COUNT      = 50;
+
+  const wchar_t *WORDS[] = {
+    L"Documents", L"Projects", L"csLabs", L"cslibs", L"csCore2", L"include",
+    L"src", L"test", L"build", L"release", L"debug", L"images", L"scans"
+  };
+  const size_t NUM_WORDS = sizeof(WORDS)/sizeof(WORDS[0]);
+
+  std::mt19937 rng(42);
+  csFuzzyCandidates<wchar_t> candidates;
+  for(size_t i = 0; i < NUM_CANDIDATES; i++) {
+    csWString path(L"C:\\Users\\cschmidt");
+    const size_t depth = 2 + rng() % 5;
+    for(size_t j = 0; j < depth; j++) {
+      path += L"\\";
+      path += WORDS[rng() % NUM_WORDS];
+    }
+    path += L"\\file" + csWString::number(rng() % 100000) + L".txt";
+    candidates.append(path);
+  }
+
+  // Typing a pattern one character at a time
+  const csWString pattern(L"cscore2srcfile42");
+  for(size_t len = 1; len <= pattern.size(); len++) {
+    const csFuzzyMatcher<wchar_t> matcher(csWStringView(pattern.data(), len));
+
+    Clock::time_point start = Clock::now();
+    const std::vector<csFuzzyMatch> matches1 = matcher.findBest(candidates, MAX_COUNT, 1);
+    const double singleSecs = secondsSince(start);
+
+    start = Clock::now();
+    const std::vector<csFuzzyMatch> matches2 = matcher.findBest(candidates, MAX_COUNT, 0);
+    const double parallelSecs = secondsSince(start);
+
+    if( matches1.size() != matches2.size() ) {
+      fprintf(stderr, "ERROR: Result mismatch!\n");
+      return EXIT_FAILURE;
+    }
+
+    printf("%-16ls %7.2f ms (1 thread), %7.2f ms (all threads), %2d matches",
+           csWString(csWStringView(pattern.data(), len)).c_str(), singleSecs*1e3, parallelSecs*1e3,
+           int(matches1.size()));
+    if( !matches1.empty() ) {
+      printf(", best: %ls", csWString(candidates[matches1.front().index]).c_str());
+    }
+    printf("\n");
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+
+#include <csCore2/csChar.h>
+#include <csCore2/csGlob.h>
+#include <csCore2/csString.h>
+#include <csCore2/csUtil.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Textbook wildcard matching of '*' and '?', backtracking to the last '*'
+bool wildcardMatch(const wchar_t *pattern, const wchar_t *text)
+{
+  const wchar_t *star = 0;
+  const wchar_t *retry = 0;
+  while( *text != L'\0' ) {
+    if(        *pattern == L'*' ) {
+      star  = ++pattern;
+      retry = text;
+    } else if( *pattern == L'?'  ||  csToLower(*pattern) == csToLower(*text) ) {
+      pattern++;
+      text++;
+    } else if( star != 0 ) {
+      pattern = star;
+      text    = ++retry;
+    } else {
+      return false;
+    }
+  }
+  while( *pattern == L'*' ) {
+    pattern++;
+  }
+  return *pattern == L'\0';
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_NAMES = 500000;
+
+  const wchar_t *EXTENSIONS[] = {
+    L".txt", L".jpg", L".pdf", L".cpp", L".h", L".TXT", L".log"
+  };
+
+  std::mt19937 rng(42);
+  std::vector<csWString> names;
+  names.reserve(NUM_NAMES);
+  for(size_t i = 0; i < NUM_NAMES; i++) {
+    const wchar_t *stem = rng() % 2 == 0
+        ? L"IMG_"
+        : L"report_";
+    names.push_back(stem + csWString::number(rng() % 1000000)
+                    + EXTENSIONS[rng() % 7]);
+  }
+
+  const wchar_t *PATTERNS[] = {
+    L"*.txt", L"img_*.jpg", L"*report*2024*", L"report_1?????.pdf"
+  };
+
+  // NOTE: Both matchers mostly wait for the names' heap storage; the best of
+  //       several runs is reported to damp the noise.
+  const int NUM_RUNS = 5;
+
+  for(const wchar_t *pattern : PATTERNS) {
+    csGlob<wchar_t> glob;
+    glob.compile(pattern, true);
+
+    double wildcardSecs = 0;
+    double globSecs     = 0;
+    size_t count1 = 0;
+    size_t count2 = 0;
+    for(int run = 0; run < NUM_RUNS; run++) {
+      Clock::time_point start = Clock::now();
+      count1 = 0;
+      for(const csWString& name : names) {
+        count1 += size_t(wildcardMatch(pattern, name.c_str()));
+      }
+      const double secs1 = secondsSince(start);
+
+      start = Clock::now();
+      count2 = 0;
+      for(const csWString& name : names) {
+        count2 += size_t(glob.match(name));
+      }
+      const double secs2 = secondsSince(start);
+
+      wildcardSecs = run == 0 ? secs1 : csMin(wildcardSecs, secs1);
+      globSecs     = run == 0 ? secs2 : csMin(globSecs, secs2);
+    }
+
+    if( count1 != count2 ) {
+      fprintf(stderr, "ERROR: Match count mismatch for \"%ls\"!\n", pattern);
+      return EXIT_FAILURE;
+    }
+
+    printf("%-20ls backtracking %6.1f ms, csGlob %6.1f ms, %d matches\n", pattern,
+           wildcardSecs*1e3, globSecs*1e3, int(count2));
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,206 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <csCore2/csFile.h>
+#include <csCore2/csUtf.h>
+
+#ifdef CS_OS_POSIX
+# include <dirent.h>
+# include <fcntl.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+#ifdef CS_OS_POSIX
+
+// NOTE: Like csListDirectory(), the baselines keep every entry's name and type.
+
+// The portable baseline: readdir() & lstat() for every entry's type
+size_t listReaddirStat(csWStringTable *files, std::vector<csFileType> *types, const char *dir)
+{
+  DIR *handle = opendir(dir);
+  if( handle == 0 ) {
+    return 0;
+  }
+
+  std::string path;
+  for(const struct dirent *entry = readdir(handle); entry != 0; entry = readdir(handle)) {
+    path.assign(dir).append(1, '/').append(entry->d_name);
+    struct stat st;
+    const bool isDir = lstat(path.data(), &st) == 0  &&  S_ISDIR(st.st_mode);
+    files->append(csFromUtf8(entry->d_name));
+    types->push_back(isDir ? csFileTypeDirectory : csFileTypeFile);
+  }
+
+  closedir(handle);
+
+  return files->size();
+}
+
+// readdir() with d_type, i.e. 32KiB batches
+size_t listReaddir(csWStringTable *files, std::vector<csFileType> *types, const char *dir)
+{
+  DIR *handle = opendir(dir);
+  if( handle == 0 ) {
+    return 0;
+  }
+
+  for(const struct dirent *entry = readdir(handle); entry != 0; entry = readdir(handle)) {
+    files->append(csFromUtf8(entry->d_name));
+    types->push_back(entry->d_type == DT_DIR ? csFileTypeDirectory : csFileTypeFile);
+  }
+
+  closedir(handle);
+
+  return files->size();
+}
+
+size_t listCs(csWStringTable *files, std::vector<csFileType> *types, const char *dir)
+{
+  return csListDirectory(files, types, csFromUtf8(dir).c_str());
+}
+
+size_t countDirectories(const std::vector<csFileType>& types)
+{
+  size_t numDirs = 0;
+  for(const csFileType type : types) {
+    numDirs += size_t(type == csFileTypeDirectory);
+  }
+  return numDirs;
+}
+
+struct Result {
+  double secs{0};
+  size_t count{0};
+  size_t numDirs{0};
+};
+
+// Best of several runs; each run lists into fresh output.
+template<typename FuncT>
+Result measure(FuncT func, const char *dir)
+{
+  const int NUM_RUNS = 5;
+
+  Result best;
+  for(int run = 0; run < NUM_RUNS; run++) {
+    csWStringTable files;
+    std::vector<csFileType> types;
+
+    const Clock::time_point start = Clock::now();
+    const size_t count = func(&files, &types, dir);
+    const double secs = secondsSince(start);
+
+    if( run == 0  ||  secs < best.secs ) {
+      best.secs    = secs;
+      best.count   = count;
+      best.numDirs = countDirectories(types);
+    }
+  }
+
+  return best;
+}
+
+int main(int argc, char **argv)
+{
+  const size_t numFiles = argc > 1
+      ? size_t(std::strtoull(argv[1], 0, 10))
+      : 1000000;
+  const std::string dir = "listdir_bench";
+
+  printf("Creating %d files in \"%s\"...\n", int(numFiles), dir.data());
+  mkdir(dir.data(), 0755);
+  char name[64];
+  for(size_t i = 0; i < numFiles; i++) {
+    snprintf(name, sizeof(name), "%s/file_%07d.txt", dir.data(), int(i));
+    const int fd = open(name, O_CREAT | O_WRONLY, 0644);
+    if( fd < 0 ) {
+      fprintf(stderr, "ERROR: Unable to create \"%s\"!\n", name);
+      return EXIT_FAILURE;
+    }
+    close(fd);
+  }
+
+  // Warm the dentry cache
+  {
+    csWStringTable files;
+    std::vector<csFileType> types;
+    listReaddir(&files, &types, dir.data());
+  }
+
+  const Result lstatBest   = measure(listReaddirStat, dir.data());
+  const Result readdirBest = measure(listReaddir, dir.data());
+  const Result csBest      = measure(listCs, dir.data());
+
+  printf("readdir+lstat   %8.1f ms, %d entries, %d directories\n",
+         lstatBest.secs*1e3, int(lstatBest.count), int(lstatBest.numDirs));
+  printf("readdir         %8.1f ms, %d entries, %d directories\n",
+         readdirBest.secs*1e3, int(readdirBest.count), int(readdirBest.numDirs));
+  printf("csListDirectory %8.1f ms, %d entries, %d directories\n",
+         csBest.secs*1e3, int(csBest.count), int(csBest.numDirs));
+
+  for(size_t i = 0; i < numFiles; i++) {
+    snprintf(name, sizeof(name), "%s/file_%07d.txt", dir.data(), int(i));
+    unlink(name);
+  }
+  rmdir(dir.data());
+
+  if( lstatBest.count != csBest.count  ||  readdirBest.count != csBest.count  ||
+      lstatBest.numDirs != csBest.numDirs  ||  readdirBest.numDirs != csBest.numDirs ) {
+    fprintf(stderr, "ERROR: Listing mismatch!\n");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+#else
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  fprintf(stderr, "ERROR: This benchmark requires a POSIX system!\n");
+  return EXIT_FAILURE;
+}
+
+#endif
@@ -0,0 +1,129 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <csCore2/csHash.h>
+#include <csCore2/csMappedFile.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+  const size_t numMiB = argc > 1
+      ? size_t(std::strtoull(argv[1], 0, 10))
+      : 512;
+  const size_t fileSize = numMiB*1024*1024;
+  const char    *NAME  = "mappedfile_bench.bin";
+  const wchar_t *WNAME = L"mappedfile_bench.bin";
+
+  printf("Creating %d MiB file \"%s\"...\n", int(numMiB), NAME);
+  {
+    csMappedFile file;
+    if( !file.create(WNAME, fileSize) ) {
+      fprintf(stderr, "ERROR: Unable to create \"%s\"!\n", NAME);
+      return EXIT_FAILURE;
+    }
+    uint8_t *data = file.writableData();
+    for(size_t i = 0; i < fileSize; i++) {
+      data[i] = uint8_t(i*31 + i/4096);
+    }
+    file.flush();
+  }
+
+  // (1) Reading into a buffer ///////////////////////////////////////////////
+
+  Clock::time_point start = Clock::now();
+  std::vector<uint8_t> buffer(fileSize);
+  FILE *f = fopen(NAME, "rb");
+  const size_t numRead = f != 0
+      ? fread(buffer.data(), 1, fileSize, f)
+      : 0;
+  if( f != 0 ) {
+    fclose(f);
+  }
+  const uint64_t hash1 = csHashBytes(buffer.data(), numRead);
+  const double readSecs = secondsSince(start);
+
+  // (2) Mapping /////////////////////////////////////////////////////////////
+
+  start = Clock::now();
+  csMappedFile file;
+  file.open(WNAME, csMapReadOnly);
+  file.advise(csMapAdviceSequential);
+  const uint64_t hash2 = csHashBytes(file.data(), file.size());
+  const double mapSecs = secondsSince(start);
+  file.close();
+
+  // (3) Mapping with csMapPopulate, hashing views on several threads ////////
+
+  start = Clock::now();
+  file.open(WNAME, csMapReadOnly, csMapPopulate);
+  const size_t numThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  std::vector<uint64_t> hashes(numThreads);
+  std::vector<std::thread> threads;
+  for(size_t i = 0; i < numThreads; i++) {
+    const csMappedView view = file.view(fileSize*i/numThreads,
+                                        fileSize*(i + 1)/numThreads - fileSize*i/numThreads);
+    threads.emplace_back([view, &hashes, i]() -> void {
+      hashes[i] = csHashBytes(view.data(), view.size());
+    });
+  }
+  file.close(); // the views keep the mapping alive
+  for(std::thread& thread : threads) {
+    thread.join();
+  }
+  const double viewSecs = secondsSince(start);
+
+  printf("fread + hash        %8.1f ms\n", readSecs*1e3);
+  printf("csMappedFile + hash %8.1f ms\n", mapSecs*1e3);
+  printf("populated, %2d views %8.1f ms\n", int(numThreads), viewSecs*1e3);
+
+  std::remove(NAME);
+
+  if( numRead != fileSize  ||  hash1 != hash2 ) {
+    fprintf(stderr, "ERROR: Hash mismatch!\n");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <csCore2/csMultiMatcher.h>
+#include <csCore2/csString.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::wstring randomWord(std::mt19937& rng, const size_t minLen, const size_t maxLen)
+{
+  std::uniform_int_distribution<size_t> lenDist(minLen, maxLen);
+  std::uniform_int_distribution<int>    chDist(0, 25);
+
+  std::wstring word(lenDist(rng), L' ');
+  for(wchar_t& ch : word) {
+    ch = wchar_t(L'a' + chDist(rng));
+  }
+  return word;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_PATTERNS = 10000;
+  const size_t TEXT_SIZE    = 16*1024*1024;
+  const size_t NUM_NAIVE    = 100;
+
+  std::mt19937 rng(42);
+
+  std::vector<std::wstring> patterns;
+  for(size_t i = 0; i < NUM_PATTERNS; i++) {
+    patterns.push_back(randomWord(rng, 5, 12));
+  }
+
+  // Random words, every 50th is a keyword
+  std::wstring text;
+  text.reserve(TEXT_SIZE + 16);
+  std::uniform_int_distribution<size_t> patDist(0, NUM_PATTERNS - 1);
+  for(size_t i = 0; text.size() < TEXT_SIZE; i++) {
+    text += i % 50 == 0
+        ? patterns[patDist(rng)]
+        : randomWord(rng, 2, 10);
+    text += L' ';
+  }
+
+  for(int ignoreCase = 0; ignoreCase <= 1; ignoreCase++) {
+    csMultiMatcher<wchar_t> matcher;
+    for(const std::wstring& pattern : patterns) {
+      matcher.addPattern(pattern);
+    }
+
+    Clock::time_point start = Clock::now();
+    matcher.compile(ignoreCase != 0);
+    const double compileSecs = secondsSince(start);
+
+    size_t numHits = 0;
+    csMultiMatcher<wchar_t>::Cursor cursor;
+    start = Clock::now();
+    matcher.scan(text.data(), text.size(), &cursor, [&numHits](const csMultiMatch&) -> bool {
+      numHits++;
+      return true;
+    });
+    const double scanSecs = secondsSince(start);
+
+    printf("csMultiMatcher (ignoreCase = %d):\n", ignoreCase);
+    printf("  compile %d patterns: %.1f ms, %.2f MB\n",
+           int(NUM_PATTERNS), compileSecs*1e3, double(matcher.memoryUsage())/1e6);
+    printf("  scan %.1f M chars: %.1f ms, %.1f M chars/s, %d hits\n",
+           double(text.size())/1e6, scanSecs*1e3, double(text.size())/scanSecs/1e6,
+           int(numHits));
+  }
+
+  // Baseline: one indexOf() pass per pattern
+  const csWString haystack(text);
+  size_t numHits = 0;
+  const Clock::time_point start = Clock::now();
+  for(size_t i = 0; i < NUM_NAIVE; i++) {
+    const csWString needle(patterns[i]);
+    int pos = -1;
+    while( (pos = haystack.indexOf(needle, pos + 1)) >= 0 ) {
+      numHits++;
+    }
+  }
+  const double naiveSecs = secondsSince(start);
+  printf("csWString::indexOf(), %d patterns: %.1f ms (extrapolated to %d: %.1f s), %d hits\n",
+         int(NUM_NAIVE), naiveSecs*1e3,
+         int(NUM_PATTERNS), naiveSecs*double(NUM_PATTERNS/NUM_NAIVE), int(numHits));
+
+  return EXIT_SUCCESS;
+}
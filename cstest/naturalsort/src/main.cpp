@@ -0,0 +1,100 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+
+#include <csCore2/csNaturalSort.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool isSorted(const csWStringList& list)
+{
+  auto prev = list.begin();
+  for(auto iter = std::next(prev); iter != list.end(); prev = iter++) {
+    if( csNaturalCmp(*prev, *iter, true) > 0 ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_FILES = 1000000;
+
+  std::mt19937 rng(42);
+  csWStringList files;
+  for(size_t i = 0; i < NUM_FILES; i++) {
+    files.push_back(L"Scan" + csWString::number(rng() % 100)
+                    + L"_page" + csWString::number(rng() % 100000)
+                    + L".pdf");
+  }
+
+  // Comparison re-parses the digit runs
+  csWStringList list1(files);
+  Clock::time_point start = Clock::now();
+  list1.sort([](const csWString& a, const csWString& b) -> bool {
+    return csNaturalCmp(a, b, true) < 0;
+  });
+  const double compareSecs = secondsSince(start);
+
+  // Sort keys, one thread
+  csWStringList list2(files);
+  start = Clock::now();
+  csNaturalSort(list2, true, 1);
+  const double keySecs = secondsSince(start);
+
+  // Sort keys, all hardware threads
+  csWStringList list3(files);
+  start = Clock::now();
+  csNaturalSort(list3, true);
+  const double parallelSecs = secondsSince(start);
+
+  if( !isSorted(list1)  ||  !isSorted(list2)  ||  !isSorted(list3) ) {
+    fprintf(stderr, "ERROR: List not sorted!\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("std::list::sort(csNaturalCmp) %7.1f ms\n", compareSecs*1e3);
+  printf("csNaturalSort, 1 thread       %7.1f ms\n", keySecs*1e3);
+  printf("csNaturalSort, all threads    %7.1f ms\n", parallelSecs*1e3);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,133 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
+
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <csCore2/csAlphaNum.h>
+#include <csCore2/csNumberParser.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool parseGrid(const std::vector<wchar_t>& text, const std::vector<float>& expected,
+               const int numThreads)
+{
+  csNumberParser<wchar_t> parser;
+  parser.setThreadCount(numThreads);
+
+  std::vector<float> values;
+  const Clock::time_point start = Clock::now();
+  const csNumberParseResult result =
+      parser.parseAll(text.data(), text.data() + text.size(), values);
+  const double secs = secondsSince(start);
+
+  if( result.error != csNumNoError  ||  values != expected ) {
+    fprintf(stderr, "ERROR: mismatch at position %d!\n", int(result.position));
+    return false;
+  }
+
+  printf("csNumberParser (%2d threads): %7.1f ms, %6.1f M values/s\n",
+         parser.threadCount(), secs*1e3, double(values.size())/secs/1e6);
+
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_ROWS    = 2000;
+  const size_t NUM_COLUMNS = 2000;
+
+  // Surface grid; space separated columns, one row per line
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(-100, 100);
+  std::vector<float> grid(NUM_ROWS*NUM_COLUMNS);
+  std::vector<wchar_t> text(grid.size()*16);
+  wchar_t *p    = text.data();
+  wchar_t *last = text.data() + text.size();
+  for(size_t i = 0; i < grid.size(); i++) {
+    grid[i] = dist(rng);
+    p = csToChars(p, last, grid[i]).ptr;
+    *p++ = (i + 1) % NUM_COLUMNS == 0
+        ? L'\n'
+        : L' ';
+  }
+  text.resize(size_t(p - text.data()));
+
+  printf("%d values, %.1f MB\n", int(grid.size()), double(text.size()*sizeof(wchar_t))/1e6);
+
+  // Baseline; one wcstof() call per value
+  text.push_back(L'\0');
+  Clock::time_point start = Clock::now();
+  std::vector<float> values;
+  const wchar_t *q = text.data();
+  while( *q != L'\0' ) {
+    wchar_t *end;
+    values.push_back(wcstof(q, &end));
+    q = end + 1;
+  }
+  const double wcstofSecs = secondsSince(start);
+  text.pop_back();
+
+  if( values != grid ) {
+    fprintf(stderr, "ERROR: wcstof() mismatch!\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("wcstof():                    %7.1f ms, %6.1f M values/s\n",
+         wcstofSecs*1e3, double(values.size())/wcstofSecs/1e6);
+
+  if( !parseGrid(text, grid, 1)  ||
+      !parseGrid(text, grid, 0) ) {
+    return EXIT_FAILURE;
+  }
+
+  // Error reporting
+  text[text.size()/2] = L'x';
+  csNumberParser<wchar_t> parser;
+  parser.setThreadCount(0);
+  const csNumberParseResult result =
+      parser.parse(text.data(), text.data() + text.size(), values.data(), values.size());
+  printf("Invalid character at %d reported at %d after %d values.\n",
+         int(text.size()/2), int(result.position), int(result.count));
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+#include <string>
+
+#include <csCore2/csString.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Baseline; std::wstring::find() & append()
+std::wstring replaceStd(const std::wstring& s, const std::wstring& before,
+                        const std::wstring& after)
+{
+  std::wstring result;
+  size_t pos = 0;
+  size_t hit;
+  while( (hit = s.find(before, pos)) != std::wstring::npos ) {
+    result.append(s, pos, hit - pos);
+    result += after;
+    pos = hit + before.size();
+  }
+  result.append(s, pos, std::wstring::npos);
+  return result;
+}
+
+bool benchmark(const char *title, const csWString& text,
+               const std::wstring& before, const std::wstring& after)
+{
+  Clock::time_point start = Clock::now();
+  const csWString result = csWString(text).replaceAll(before, after);
+  const double secs = secondsSince(start);
+
+  start = Clock::now();
+  const std::wstring expected = replaceStd(text, before, after);
+  const double stdSecs = secondsSince(start);
+
+  if( result != expected ) {
+    fprintf(stderr, "ERROR: %s mismatch!\n", title);
+    return false;
+  }
+
+  printf("%-24s %8.1f ms (std:  %8.1f ms)\n", title, secs*1e3, stdSecs*1e3);
+
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_LINES = 200000;
+
+  // Windows paths with escaped line breaks
+  std::mt19937 rng(42);
+  csWString text;
+  for(size_t i = 0; i < NUM_LINES; i++) {
+    text += L"C:\\Users\\cschmidt\\Documents\\project";
+    text += csWString::number(rng());
+    text += L"\\data\\file.txt";
+    text += i % 4 == 0
+        ? L"\\n"
+        : L"\n";
+  }
+
+  printf("%.1f MB\n", double(text.size()*sizeof(wchar_t))/1e6);
+
+  Clock::time_point start = Clock::now();
+  const csWString slashes = csWString(text).replace(L'\\', L'/');
+  const double replaceSecs = secondsSince(start);
+
+  start = Clock::now();
+  std::wstring expected = text;
+  for(wchar_t& ch : expected) {
+    if( ch == L'\\' ) {
+      ch = L'/';
+    }
+  }
+  const double loopSecs = secondsSince(start);
+
+  if( slashes != expected ) {
+    fprintf(stderr, "ERROR: replace() mismatch!\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("%-24s %8.1f ms (loop:  %8.1f ms)\n", "replace('\\\\', '/')",
+         replaceSecs*1e3, loopSecs*1e3);
+
+  if( !benchmark("replaceAll(\"\\\\\", \"/\")", text, L"\\", L"/")              ||
+      !benchmark("replaceAll(\"\\\\n\", \"\\n\")", text, L"\\n", L"\n")        ||
+      !benchmark("replaceAll(\"\\n\", \"\\r\\n\")", text, L"\n", L"\r\n")      ||
+      !benchmark("replaceAll(\"\\\\\", \"\\\\\\\\\")", text, L"\\", L"\\\\") ) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+
+#include <csCore2/csString.h>
+#include <csCore2/csStringList.h>
+#include <csCore2/csStringSplit.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Baseline; copy every token into a csWStringList
+csWStringList splitList(const csWString& s, const wchar_t delimiter)
+{
+  csWStringList result;
+  size_t pos = 0;
+  size_t hit;
+  while( (hit = s.find(delimiter, pos)) != csWString::npos ) {
+    result.push_back(s.substr(pos, hit - pos));
+    pos = hit + 1;
+  }
+  result.push_back(s.substr(pos));
+  return result;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_LINES = 200000;
+
+  // CSV with a long text column
+  std::mt19937 rng(42);
+  csWString text;
+  for(size_t i = 0; i < NUM_LINES; i++) {
+    text += csWString::number(rng());
+    text += L",";
+    text += csWString::number(double(rng())/1000.0);
+    text += L",The quick brown fox jumps over the lazy dog;";
+    text += csWString::number(i);
+    text += L"\n";
+  }
+
+  printf("%.1f MB\n", double(text.size()*sizeof(wchar_t))/1e6);
+
+  Clock::time_point start = Clock::now();
+  size_t numFields = 0;
+  size_t numChars = 0;
+  for(const csWStringView& line : text.split(L'\n', csSkipEmptyParts)) {
+    for(const csWStringView& field : csWStringSplit::anyOf(line, L",;")) {
+      numFields++;
+      numChars += field.size();
+    }
+  }
+  const double splitSecs = secondsSince(start);
+
+  start = Clock::now();
+  const csWStringTable table = text.split(L'\n', csSkipEmptyParts).collect();
+  const double collectSecs = secondsSince(start);
+
+  start = Clock::now();
+  const csWStringList list = splitList(text, L'\n');
+  const double listSecs = secondsSince(start);
+
+  // NOTE: The list holds a trailing empty line.
+  if( numFields != NUM_LINES*4  ||  table.size() + 1 != list.size() ) {
+    fprintf(stderr, "ERROR: split() mismatch!\n");
+    return EXIT_FAILURE;
+  }
+
+  printf("%-24s %8.1f ms (%zu fields, %zu chars)\n", "split() lines & fields",
+         splitSecs*1e3, numFields, numChars);
+  printf("%-24s %8.1f ms\n", "collect() lines", collectSecs*1e3);
+  printf("%-24s %8.1f ms\n", "csWStringList lines", listSecs*1e3);
+
+  return EXIT_SUCCESS;
+}
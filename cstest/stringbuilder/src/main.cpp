@@ -0,0 +1,138 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <vector>
+
+#include <csCore2/csAlphaNum.h>
+#include <csCore2/csStringBuilder.h>
+#include <csCore2/csStringLib.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+const wchar_t *LINE = L"2025-01-01 12:00:00 [info] report line, value = ";
+
+// Assembles numLines lines like "<LINE><number>\n"
+size_t buildCat(const size_t numLines, std::vector<wchar_t>& dest)
+{
+  wchar_t num[33];
+  dest[0] = L'\0';
+  for(size_t i = 0; i < numLines; i++) {
+    csToStr(num, sizeof(num)/sizeof(wchar_t), i);
+    csStringCat(dest.data(), LINE);
+    csStringCat(dest.data(), num);
+    csStringCat(dest.data(), L"\n");
+  }
+  return csStringLen(dest.data());
+}
+
+size_t buildBuilder(const size_t numLines)
+{
+  csWStringBuilder builder;
+  for(size_t i = 0; i < numLines; i++) {
+    builder.append(LINE).appendNumber(i).append(L'\n');
+  }
+  const csWString result = builder.take();
+  return result.size();
+}
+
+// Fills a caller-provided buffer, then overflows it to the heap
+bool checkBuffer()
+{
+  wchar_t buffer[64];
+  csWStringBuilder builder(buffer, sizeof(buffer)/sizeof(wchar_t));
+
+  builder.append(L"short ").appendNumber(42);
+  if( builder.c_str() != buffer  ||  builder.view() != csWStringView(L"short 42") ) {
+    fprintf(stderr, "ERROR: inline buffer mismatch!\n");
+    return false;
+  }
+
+  csWString expected(L"short 42");
+  for(size_t i = 0; i < 100; i++) {
+    builder.append(LINE).appendNumber(i).append(L'\n');
+    expected += LINE + csWString::number(i) + L"\n";
+  }
+  if( builder.c_str() == buffer  ||  builder.view() != expected ) {
+    fprintf(stderr, "ERROR: heap overflow mismatch!\n");
+    return false;
+  }
+
+  // take() keeps the buffer for the next string
+  if( builder.take() != expected  ||  !builder.empty() ) {
+    fprintf(stderr, "ERROR: take() mismatch!\n");
+    return false;
+  }
+  builder.append(L"reused");
+  if( builder.c_str() != buffer  ||  builder.take() != csWString(L"reused") ) {
+    fprintf(stderr, "ERROR: buffer reuse mismatch!\n");
+    return false;
+  }
+
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  if( !checkBuffer() ) {
+    return EXIT_FAILURE;
+  }
+
+  printf("%10s %14s %14s\n", "lines", "csStringCat", "builder");
+  for(size_t numLines = 1000; numLines <= 16000; numLines *= 4) {
+    std::vector<wchar_t> dest(numLines*64 + 1);
+
+    Clock::time_point start = Clock::now();
+    const size_t lenCat = buildCat(numLines, dest);
+    const double secsCat = secondsSince(start);
+
+    start = Clock::now();
+    const size_t lenBuilder = buildBuilder(numLines);
+    const double secsBuilder = secondsSince(start);
+
+    if( lenCat != lenBuilder ) {
+      fprintf(stderr, "ERROR: length mismatch (%d != %d)!\n", int(lenCat), int(lenBuilder));
+      return EXIT_FAILURE;
+    }
+
+    printf("%10d %11.3f ms %11.3f ms\n", int(numLines), secsCat*1e3, secsBuilder*1e3);
+  }
+
+  return EXIT_SUCCESS;
+}
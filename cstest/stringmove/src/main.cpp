@@ -0,0 +1,142 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <csCore2/csStringList.h>
+
+////// Allocation counter ////////////////////////////////////////////////////
+
+static size_t g_numAllocs = 0;
+
+void *operator new(size_t size)
+{
+  g_numAllocs++;
+  void *p = malloc(size > 0  ?  size : 1);
+  if( p == nullptr ) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void *p) noexcept
+{
+  free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+  free(p);
+}
+
+////// Test cases ////////////////////////////////////////////////////////////
+
+// Long enough to defeat any small string optimization
+#define LONG_TEXT  L"The quick brown fox jumps over the lazy dog"
+
+csWString makeString()
+{
+  csWString s(LONG_TEXT);
+  return s;
+}
+
+csWStringList makeList(const size_t count)
+{
+  csWStringList list;
+  for(size_t i = 0; i < count; i++) {
+    list.push_back(csWString(LONG_TEXT));
+  }
+  return list;
+}
+
+bool check(const char *what, const size_t expected, const size_t begin)
+{
+  const size_t actual = g_numAllocs - begin;
+  printf("%-40s %3d allocations (expected %3d) - %s\n",
+         what, int(actual), int(expected), actual == expected  ?  "OK" : "FAILED");
+  return actual == expected;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  bool ok = true;
+  size_t begin;
+
+  begin = g_numAllocs;
+  {
+    csWString s = makeString();
+  }
+  ok = check("return by value", 1, begin)  &&  ok;
+
+  begin = g_numAllocs;
+  {
+    csWString s = makeString().mid(4);
+  }
+  ok = check("mid() of temporary", 1, begin)  &&  ok;
+
+  begin = g_numAllocs;
+  {
+    csWString s = makeString().replace(L' ', L'_');
+  }
+  ok = check("replace() of temporary", 1, begin)  &&  ok;
+
+  begin = g_numAllocs;
+  {
+    csWString s = makeString();
+    csWString t;
+    t = std::move(s);
+  }
+  ok = check("move assignment", 1, begin)  &&  ok;
+
+  begin = g_numAllocs;
+  {
+    csWStringList list = makeList(10);
+    csWStringList other;
+    other = std::move(list);
+  }
+  ok = check("list of 10; return & move assignment", 10*2, begin)  &&  ok;
+
+  begin = g_numAllocs;
+  {
+    std::vector<csWString> v;
+    v.reserve(1);
+    v.push_back(makeString());
+    v.reserve(2); // relocate with noexcept move
+  }
+  ok = check("vector relocation", 1+1+1, begin)  &&  ok;
+
+  return ok  ?  EXIT_SUCCESS : EXIT_FAILURE;
+}
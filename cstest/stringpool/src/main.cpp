@@ -0,0 +1,191 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <csCore2/csString.h>
+#include <csCore2/csStringPool.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool check(const bool condition, const char *what)
+{
+  if( !condition ) {
+    fprintf(stderr, "ERROR: %s!\n", what);
+  }
+  return condition;
+}
+
+// Equal strings from different buffers intern to the same copy.
+bool checkInterning()
+{
+  csStringPool<wchar_t> pool;
+
+  const std::wstring a1(L"alpha");
+  const std::wstring a2(L"alpha");
+  const std::wstring b(L"beta");
+  const std::wstring nul(L"al\0pha", 6);
+
+  const csStringHandle ha1 = pool.insert(csWStringView(a1.data(), a1.size()));
+  const csStringHandle ha2 = pool.insert(csWStringView(a2.data(), a2.size()));
+  const csStringHandle hb  = pool.insert(csWStringView(b.data(), b.size()));
+  const csStringHandle hn  = pool.insert(csWStringView(nul.data(), nul.size()));
+  const csStringHandle he  = pool.insert(csWStringView(L"", 0));
+
+  bool ok = true;
+  ok = check(ha1 != csInvalidStringHandle  &&  ha1 == ha2, "Equal strings, different handles")  &&  ok;
+  ok = check(pool.value(ha1) == pool.value(ha2)  &&
+             pool.value(ha1).data() == pool.value(ha2).data(), "Equal strings, different views")  &&  ok;
+  ok = check(pool.value(ha1).data() != a1.data(), "String not copied")  &&  ok;
+  ok = check(hb != ha1  &&  pool.value(hb) == csWStringView(L"beta"), "Distinct strings mixed up")  &&  ok;
+  ok = check(hn != ha1  &&  pool.value(hn).size() == 6, "Embedded NUL lost")  &&  ok;
+  ok = check(he != csInvalidStringHandle  &&  pool.value(he).empty(), "Empty string not interned")  &&  ok;
+  ok = check(pool.c_str(ha1)[5] == L'\0', "Missing terminating NUL")  &&  ok;
+  ok = check(pool.find(csWStringView(L"beta")) == hb, "find() mismatch")  &&  ok;
+  ok = check(pool.find(csWStringView(L"gamma")) == csInvalidStringHandle, "find() of a missing string")  &&  ok;
+  ok = check(pool.size() == 4, "size() mismatch")  &&  ok;
+
+  return ok;
+}
+
+// Views stay valid while the pool grows: new chunks, rehashing, large strings.
+bool checkStability(const int numShards)
+{
+  csStringPool<wchar_t> pool(numShards);
+
+  std::vector<csWString> strings;
+  std::vector<csStringHandle> handles;
+  std::vector<const wchar_t*> pointers;
+  for(size_t i = 0; i < 100; i++) {
+    strings.push_back(L"first_" + csWString::number(i));
+    handles.push_back(pool.insert(strings.back()));
+    pointers.push_back(pool.value(handles.back()).data());
+  }
+
+  const csWString large(100000, L'x');
+  pool.insert(large);
+  for(size_t i = 0; i < 200000; i++) {
+    pool.insert(L"more_" + csWString::number(i));
+  }
+
+  bool ok = true;
+  for(size_t i = 0; i < strings.size(); i++) {
+    const csWStringView v = pool.value(handles[i]);
+    ok = check(v.data() == pointers[i], "String moved")  &&  ok;
+    ok = check(v == strings[i], "String changed")  &&  ok;
+    ok = check(pool.insert(strings[i]) == handles[i], "Handle changed")  &&  ok;
+  }
+  ok = check(pool.size() == 100 + 1 + 200000, "size() mismatch after growth")  &&  ok;
+
+  return ok;
+}
+
+// clear() forgets every string; handles & views become invalid.
+bool checkClear()
+{
+  csStringPool<wchar_t> pool;
+
+  const csStringHandle h = pool.insert(csWStringView(L"kept?"));
+  pool.clear();
+
+  const csStringPoolStatistics stats = pool.statistics();
+
+  bool ok = true;
+  ok = check(pool.size() == 0  &&  stats.numStrings == 0  &&  stats.numChars == 0  &&
+             stats.arenaBytes == 0, "Strings left after clear()")  &&  ok;
+  ok = check(pool.find(csWStringView(L"kept?")) == csInvalidStringHandle, "find() after clear()")  &&  ok;
+  ok = check(pool.value(h).empty()  &&  pool.c_str(h)[0] == L'\0', "Stale handle not empty")  &&  ok;
+
+  const csStringHandle again = pool.insert(csWStringView(L"kept?"));
+  ok = check(again != csInvalidStringHandle  &&  pool.value(again) == csWStringView(L"kept?"),
+             "Insert after clear()")  &&  ok;
+  ok = check(pool.size() == 1, "size() mismatch after clear()")  &&  ok;
+
+  return ok;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  if( !checkInterning()  ||  !checkStability(1)  ||  !checkStability(4)  ||  !checkClear() ) {
+    return EXIT_FAILURE;
+  }
+
+  // File names, most of them repeated
+  const size_t NUM_NAMES  = 2000000;
+  const size_t NUM_UNIQUE = 100000;
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<size_t> dist(0, NUM_UNIQUE - 1);
+  std::vector<csWString> names;
+  names.reserve(NUM_NAMES);
+  for(size_t i = 0; i < NUM_NAMES; i++) {
+    names.push_back(L"C:\\Data\\Project\\file_" + csWString::number(dist(rng)) + L".txt");
+  }
+
+  Clock::time_point start = Clock::now();
+  csStringPool<wchar_t> pool;
+  for(const csWString& name : names) {
+    pool.insert(name);
+  }
+  const double poolSecs = secondsSince(start);
+
+  start = Clock::now();
+  std::unordered_set<std::wstring> set;
+  for(const csWString& name : names) {
+    set.insert(name);
+  }
+  const double setSecs = secondsSince(start);
+
+  if( pool.size() != set.size() ) {
+    fprintf(stderr, "ERROR: Unique count mismatch (%d != %d)!\n", int(pool.size()), int(set.size()));
+    return EXIT_FAILURE;
+  }
+
+  const csStringPoolStatistics stats = pool.statistics();
+  printf("%d names, %d unique:\n", int(NUM_NAMES), int(pool.size()));
+  printf("  csStringPool            %8.1f ms, %.2f MB\n",
+         poolSecs*1e3, double(stats.arenaBytes + stats.indexBytes)/1e6);
+  printf("  std::unordered_set      %8.1f ms\n", setSecs*1e3);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,14 @@
+TEMPLATE = app
+CONFIG += console c++17
+CONFIG -= app_bundle
+CONFIG -= qt
+
+include(../../global.pri)
+
+INCLUDEPATH += ../../cslibs/include
+DEPENDPATH  += ../../cslibs/include
+
+LIBS += -L../../lib -lcsCore2$${TARGET_POSTFIX}
+
+SOURCES += \
+  src/main.cpp
@@ -0,0 +1,107 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <csCore2/csStringLib.h>
+#include <csCore2/csStringSort.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool benchmark(const std::vector<csWString>& input, const bool ignoreCase)
+{
+  const auto isLess = [=](const csWString& a, const csWString& b) -> bool {
+    return ignoreCase
+        ? csStringCmpI(a.c_str(), b.c_str()) < 0
+        : csStringCmp(a.c_str(), b.c_str())  < 0;
+  };
+
+  std::vector<csWString> strings1(input);
+  Clock::time_point start = Clock::now();
+  std::sort(strings1.begin(), strings1.end(), isLess);
+  const double stdSecs = secondsSince(start);
+
+  std::vector<csWString> strings2(input);
+  start = Clock::now();
+  csStringSort(strings2, ignoreCase, 1);
+  const double sortSecs = secondsSince(start);
+
+  std::vector<csWString> strings3(input);
+  start = Clock::now();
+  csStringSort(strings3, ignoreCase);
+  const double parallelSecs = secondsSince(start);
+
+  for(size_t i = 0; i < strings1.size(); i++) {
+    if( isLess(strings1[i], strings2[i])  ||  isLess(strings2[i], strings1[i])  ||
+        isLess(strings1[i], strings3[i])  ||  isLess(strings3[i], strings1[i]) ) {
+      fprintf(stderr, "ERROR: Order mismatch at %d!\n", int(i));
+      return false;
+    }
+  }
+
+  printf("%s: std::sort %7.1f ms, csStringSort %7.1f ms (1 thread), %7.1f ms (all threads)\n",
+         ignoreCase ? "csStringCmpI" : "csStringCmp ",
+         stdSecs*1e3, sortSecs*1e3, parallelSecs*1e3);
+
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_STRINGS = 1000000;
+
+  // Paths sharing long prefixes
+  std::mt19937 rng(42);
+  std::vector<csWString> strings;
+  strings.reserve(NUM_STRINGS);
+  for(size_t i = 0; i < NUM_STRINGS; i++) {
+    strings.push_back(L"C:\\Users\\cschmidt\\Documents\\Project"
+                      + csWString::number(rng() % 100) + L"\\Data\\file"
+                      + csWString::number(rng()) + L".txt");
+  }
+
+  if( !benchmark(strings, false)  ||  !benchmark(strings, true) ) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
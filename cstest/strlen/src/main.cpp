@@ -0,0 +1,105 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+
+#include <chrono>
+#include <vector>
+
+#include <csCore2/csStringLib.h>
+#include <csCore2/csUtil.h>
+
+using Clock = std::chrono::steady_clock;
+
+template<typename CharT>
+using LenFunc = size_t (*)(const CharT *);
+
+template<typename CharT>
+std::vector<CharT> makeString(const size_t len)
+{
+  std::vector<CharT> s(len + 1, CharT('x'));
+  s[len] = CharT(0);
+  return s;
+}
+
+template<typename CharT>
+double measure(LenFunc<CharT> func, const std::vector<CharT>& s, const size_t reps)
+{
+  // Prevent the compiler from hoisting the (pure) call out of the loop
+  LenFunc<CharT> volatile lenFunc = func;
+
+  size_t sum = 0;
+  const Clock::time_point start = Clock::now();
+  for(size_t i = 0; i < reps; i++) {
+    sum += lenFunc(s.data());
+  }
+  const double secs = std::chrono::duration<double>(Clock::now() - start).count();
+
+  if( sum != reps*(s.size() - 1) ) {
+    printf("ERROR: length mismatch!\n");
+  }
+
+  return double(reps*s.size()*sizeof(CharT))/secs/1e9;
+}
+
+template<typename CharT>
+void run(const char *name, LenFunc<CharT> reference, const char *refName)
+{
+  const size_t lengths[] = { 7, 31, 100, 1000, 10000, 100000, 10000000 };
+  const size_t bytesPerLength = 1000000000;
+
+  printf("%s (%d bytes/char)\n", name, int(sizeof(CharT)));
+  printf("%10s %12s %12s\n", "length", "csStringLen", refName);
+  for(const size_t len : lengths) {
+    const std::vector<CharT> s = makeString<CharT>(len);
+    const size_t reps = csMax<size_t>(bytesPerLength/(len*sizeof(CharT)), 1);
+
+    const double gbs    = measure<CharT>(csStringLen<CharT>, s, reps);
+    const double gbsRef = measure<CharT>(reference, s, reps);
+    printf("%10d %9.2f GB/s %7.2f GB/s\n", int(len), gbs, gbsRef);
+  }
+  printf("\n");
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+#ifdef HAVE_CHAR
+  run<char>("char", strlen, "strlen");
+#endif
+#ifdef HAVE_WCHAR_T
+  run<wchar_t>("wchar_t", wcslen, "wcslen");
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <csCore2/csAlphaNum.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+bool benchmarkIds()
+{
+  const size_t NUM_IDS = 10000000;
+
+  std::mt19937_64 rng(42);
+  std::vector<uint64_t> ids(NUM_IDS);
+  for(uint64_t& id : ids) {
+    id = rng() >> (rng() % 64);
+  }
+
+  // Format: newline separated IDs
+  std::vector<wchar_t> text(NUM_IDS*21);
+  wchar_t *last = text.data() + text.size();
+  Clock::time_point start = Clock::now();
+  wchar_t *p = text.data();
+  for(const uint64_t id : ids) {
+    p = csToChars(p, last, id).ptr;
+    *p++ = L'\n';
+  }
+  const double formatSecs = secondsSince(start);
+  last = p;
+
+  // Parse
+  start = Clock::now();
+  uint64_t sum = 0;
+  size_t   count = 0;
+  const wchar_t *q = text.data();
+  while( q < last ) {
+    uint64_t id;
+    const csFromCharsResult<wchar_t> result = csFromChars(q, last, id);
+    if( result.error != csNumNoError  ||  id != ids[count] ) {
+      fprintf(stderr, "ERROR: mismatch at ID %d!\n", int(count));
+      return false;
+    }
+    sum += id;
+    count++;
+    q = result.ptr + 1;
+  }
+  const double parseSecs = secondsSince(start);
+
+  // Baseline
+  start = Clock::now();
+  uint64_t sumWcstoull = 0;
+  q = text.data();
+  while( q < last ) {
+    wchar_t *end;
+    sumWcstoull += wcstoull(q, &end, 10);
+    q = end + 1;
+  }
+  const double wcstoullSecs = secondsSince(start);
+
+  if( sum != sumWcstoull ) {
+    fprintf(stderr, "ERROR: checksum mismatch!\n");
+    return false;
+  }
+
+  printf("%d IDs, %.1f MB\n", int(count), double(last - text.data())*sizeof(wchar_t)/1e6);
+  printf("csToChars(uint64_t):   %7.1f ms, %6.1f M IDs/s\n",
+         formatSecs*1e3, double(count)/formatSecs/1e6);
+  printf("csFromChars(uint64_t): %7.1f ms, %6.1f M IDs/s\n",
+         parseSecs*1e3, double(count)/parseSecs/1e6);
+  printf("wcstoull():            %7.1f ms, %6.1f M IDs/s\n",
+         wcstoullSecs*1e3, double(count)/wcstoullSecs/1e6);
+
+  return true;
+}
+
+bool benchmarkDoubles()
+{
+  const size_t NUM_VALUES = 10000000;
+
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> dist(-1000, 1000);
+  std::vector<double> values(NUM_VALUES);
+  for(double& value : values) {
+    value = dist(rng);
+  }
+
+  // Format: newline separated values
+  std::vector<wchar_t> text(NUM_VALUES*32);
+  wchar_t *last = text.data() + text.size();
+  Clock::time_point start = Clock::now();
+  wchar_t *p = text.data();
+  for(const double value : values) {
+    p = csToChars(p, last, value).ptr;
+    *p++ = L'\n';
+  }
+  const double formatSecs = secondsSince(start);
+  last = p;
+
+  // Baseline
+  std::vector<wchar_t> textPrintf(NUM_VALUES*32);
+  start = Clock::now();
+  p = textPrintf.data();
+  for(const double value : values) {
+    p += swprintf(p, 32, L"%.17g\n", value);
+  }
+  const double printfSecs = secondsSince(start);
+
+  // Parse; the shortest representation must round-trip
+  start = Clock::now();
+  size_t count = 0;
+  const wchar_t *q = text.data();
+  while( q < last ) {
+    double value;
+    const csFromCharsResult<wchar_t> result = csFromChars(q, last, value);
+    if( result.error != csNumNoError  ||  value != values[count] ) {
+      fprintf(stderr, "ERROR: mismatch at value %d!\n", int(count));
+      return false;
+    }
+    count++;
+    q = result.ptr + 1;
+  }
+  const double parseSecs = secondsSince(start);
+
+  // Baseline
+  start = Clock::now();
+  double sumWcstod = 0;
+  q = text.data();
+  while( q < last ) {
+    wchar_t *end;
+    sumWcstod += wcstod(q, &end);
+    q = end + 1;
+  }
+  const double wcstodSecs = secondsSince(start);
+
+  printf("%d doubles, %.1f MB (%%.17g: %.1f MB), checksum %g\n", int(count),
+         double(last - text.data())*sizeof(wchar_t)/1e6,
+         double(p - textPrintf.data())*sizeof(wchar_t)/1e6, sumWcstod);
+  printf("csToChars(double):     %7.1f ms, %6.1f M values/s\n",
+         formatSecs*1e3, double(count)/formatSecs/1e6);
+  printf("swprintf(%%.17g):       %7.1f ms, %6.1f M values/s\n",
+         printfSecs*1e3, double(count)/printfSecs/1e6);
+  printf("csFromChars(double):   %7.1f ms, %6.1f M values/s\n",
+         parseSecs*1e3, double(count)/parseSecs/1e6);
+  printf("wcstod():              %7.1f ms, %6.1f M values/s\n",
+         wcstodSecs*1e3, double(count)/wcstodSecs/1e6);
+
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  if( !benchmarkIds()  ||  !benchmarkDoubles() ) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,121 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <chrono>
+#include <codecvt>
+#include <locale>
+#include <random>
+#include <string>
+
+#include <csCore2/csUtf.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Directory listing; every fourth name has non-ASCII characters
+std::string makeText(const size_t numLines)
+{
+  const char *names[4] = {
+    "report", "data", "Gr\xC3\xB6\xC3\x9F" "e", "\xE6\x96\x87\xE4\xBB\xB6"
+  };
+
+  std::mt19937 rng(42);
+  std::string text;
+  for(size_t i = 0; i < numLines; i++) {
+    text += "/home/cschmidt/projects/csLabs/build/";
+    text += names[i % 4];
+    text += std::to_string(rng());
+    text += ".txt\n";
+  }
+
+  return text;
+}
+
+bool benchmark(const char *title, const std::string& text)
+{
+  // NOTE: std::wstring_convert is deprecated, yet the only portable baseline.
+  std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
+
+  Clock::time_point start = Clock::now();
+  csUtfResult result;
+  const csWString wide = csFromUtf8(text, &result);
+  const double fromSecs = secondsSince(start);
+
+  start = Clock::now();
+  const std::wstring expected = convert.from_bytes(text);
+  const double stdFromSecs = secondsSince(start);
+
+  start = Clock::now();
+  const std::string utf8 = csToUtf8(wide);
+  const double toSecs = secondsSince(start);
+
+  start = Clock::now();
+  const std::string stdUtf8 = convert.to_bytes(expected);
+  const double stdToSecs = secondsSince(start);
+
+  if( result.error != csUtfNoError  ||  wide != expected  ||  utf8 != text  ||  stdUtf8 != text ) {
+    fprintf(stderr, "ERROR: %s mismatch!\n", title);
+    return false;
+  }
+
+  const double mb = double(text.size())/1e6;
+  printf("%-12s UTF-8 -> wide %7.0f MB/s (std: %6.0f MB/s), wide -> UTF-8 %7.0f MB/s (std: %6.0f MB/s)\n",
+         title, mb/fromSecs, mb/stdFromSecs, mb/toSecs, mb/stdToSecs);
+
+  return true;
+}
+
+int main(int /*argc*/, char ** /*argv*/)
+{
+  const size_t NUM_LINES = 500000;
+
+  const std::string mixed = makeText(NUM_LINES);
+
+  std::string ascii = mixed;
+  for(char& ch : ascii) {
+    if( (ch & 0x80) != 0 ) {
+      ch = '_';
+    }
+  }
+
+  if( !benchmark("ASCII", ascii)  ||  !benchmark("mixed", mixed) ) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
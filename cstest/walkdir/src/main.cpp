@@ -0,0 +1,128 @@
+/****************************************************************************
+** Copyright (c) 2025, Carsten Schmidt. All rights reserved.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+** 1. Redistributions of source code must retain the above copyright
+**    notice, this list of conditions and the following disclaimer.
+**
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+**
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <csCore2/csFile.h>
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(const Clock::time_point& start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Creates numDirs directories of numFiles empty files each, nested
+// three levels deep
+void createTree(const std::filesystem::path& root, const size_t numDirs, const size_t numFiles)
+{
+  for(size_t i = 0; i < numDirs; i++) {
+    const std::filesystem::path dir = root
+        / ("a" + std::to_string(i % 10))
+        / ("b" + std::to_string(i % 100))
+        / ("c" + std::to_string(i));
+    std::filesystem::create_directories(dir);
+    for(size_t j = 0; j < numFiles; j++) {
+      std::ofstream(dir / ("file_" + std::to_string(j) + (j % 4 == 0  ?  ".txt" : ".dat")));
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const size_t numDirs = argc > 1
+      ? size_t(std::strtoull(argv[1], 0, 10))
+      : 2000;
+  const size_t numFiles = argc > 2
+      ? size_t(std::strtoull(argv[2], 0, 10))
+      : 500;
+  const std::filesystem::path root("walkdir_bench");
+
+  printf("Creating %d directories of %d files in \"%s\"...\n",
+         int(numDirs), int(numFiles), root.string().data());
+  createTree(root, numDirs, numFiles);
+
+  Clock::time_point start = Clock::now();
+  size_t count1 = 0;
+  for(const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+    count1 += size_t(entry.is_regular_file());
+  }
+  const double stdSecs = secondsSince(start);
+
+  printf("recursive_directory_iterator  %8.1f ms, %d files\n", stdSecs*1e3, int(count1));
+
+  for(const int threadCount : {1, 0}) {
+    csWalkOptions options;
+    options.threadCount = threadCount;
+
+    start = Clock::now();
+    std::atomic<size_t> count2(0);
+    csWalkDirectory(root.wstring().data(), [&](const csWalkEntry& entry) -> bool {
+      if( entry.type == csFileTypeFile ) {
+        count2++;
+      }
+      return true;
+    }, options);
+    const double csSecs = secondsSince(start);
+
+    printf("csWalkDirectory %-13s %8.1f ms, %d files\n",
+           threadCount == 1  ?  "(1 thread)" : "(all threads)", csSecs*1e3, int(count2));
+
+    if( count1 != count2 ) {
+      fprintf(stderr, "ERROR: File count mismatch!\n");
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Filtered: only "*.txt", skipping "a0"
+  csWalkOptions options;
+  options.include.push_back(L"*.txt");
+  options.exclude.push_back(L"a0");
+
+  start = Clock::now();
+  std::atomic<size_t> count3(0);
+  csWalkDirectory(root.wstring().data(), [&](const csWalkEntry&) -> bool {
+    count3++;
+    return true;
+  }, options);
+  printf("csWalkDirectory (*.txt)       %8.1f ms, %d files\n", secondsSince(start)*1e3, int(count3));
+
+  std::filesystem::remove_all(root);
+
+  return EXIT_SUCCESS;
+}